@@ -9,6 +9,7 @@
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "Vehicles/BaseVehicle.h"
+#include "Vehicles/PawnHandoffSubsystem.h"
 #include "Engine/World.h"
 #include "Materials/MaterialInstance.h"
 
@@ -190,15 +191,13 @@ void AExplorerCharacter::EnterVehicle(ABaseVehicle* Vehicle)
     if (!Vehicle)
         return;
 
-    CurrentVehicle = Vehicle;
-
-    // Disable character movement and collision
-    GetCharacterMovement()->DisableMovement();
-    GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    ParkInVehicle(Vehicle);
 
-    // Attach character to vehicle
-    FAttachmentTransformRules AttachRules(EAttachmentRule::SnapToTarget, true);
-    AttachToComponent(Vehicle->GetRootComponent(), AttachRules, NAME_None);
+    // We ride along and come back out when the vehicle is left
+    if (UPawnHandoffSubsystem* Handoff = GetWorld()->GetSubsystem<UPawnHandoffSubsystem>())
+    {
+        Handoff->RegisterDriver(Vehicle, this);
+    }
 
     // Set vehicle as the possessed pawn
     AController* CharacterController = GetController();
@@ -207,9 +206,6 @@ void AExplorerCharacter::EnterVehicle(ABaseVehicle* Vehicle)
         CharacterController->UnPossess();
         CharacterController->Possess(Vehicle);
     }
-
-    // Hide character mesh
-    GetMesh()->SetVisibility(false);
 }
 
 void AExplorerCharacter::ExitVehicle()
@@ -217,22 +213,35 @@ void AExplorerCharacter::ExitVehicle()
     if (!CurrentVehicle)
         return;
 
-    // Get exit location
-    FVector ExitLocation = CurrentVehicle->GetActorLocation() + CurrentVehicle->GetActorRightVector() * 200.0f;
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(CurrentVehicle);
-    QueryParams.AddIgnoredActor(this);
-
-    // Find a suitable exit point
-    GetWorld()->LineTraceSingleByChannel(HitResult, ExitLocation + FVector(0, 0, 200.0f), ExitLocation - FVector(0, 0, 200.0f), ECC_Visibility, QueryParams);
-    if (HitResult.bBlockingHit)
+    // The exit spot is found asynchronously, we're handed control once it's known
+    if (UPawnHandoffSubsystem* Handoff = GetWorld()->GetSubsystem<UPawnHandoffSubsystem>())
     {
-        ExitLocation = HitResult.Location + FVector(0, 0, 100.0f);
+        Handoff->RequestExit(CurrentVehicle);
     }
+}
 
+void AExplorerCharacter::ParkInVehicle(ABaseVehicle* Vehicle)
+{
+    CurrentVehicle = Vehicle;
+
+    // Disable character movement and collision
+    GetCharacterMovement()->DisableMovement();
+    GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+    // Attach character to vehicle
+    FAttachmentTransformRules AttachRules(EAttachmentRule::SnapToTarget, true);
+    AttachToComponent(Vehicle->GetRootComponent(), AttachRules, NAME_None);
+
+    // Hide character mesh, nothing needs to update while we're parked
+    GetMesh()->SetVisibility(false);
+    SetActorTickEnabled(false);
+}
+
+void AExplorerCharacter::LeaveVehicle(const FVector& ExitLocation, const FRotator& ExitRotation)
+{
     // Detach from vehicle
     DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    SetActorLocationAndRotation(ExitLocation, ExitRotation);
 
     // Enable character movement and collision
     GetCharacterMovement()->SetMovementMode(MOVE_Walking);
@@ -240,17 +249,7 @@ void AExplorerCharacter::ExitVehicle()
 
     // Show character mesh
     GetMesh()->SetVisibility(true);
-
-    // Set location
-    SetActorLocation(ExitLocation);
-
-    // Repossess character
-    AController* VehicleController = CurrentVehicle->GetController();
-    if (VehicleController)
-    {
-        VehicleController->UnPossess();
-        VehicleController->Possess(this);
-    }
+    SetActorTickEnabled(true);
 
     CurrentVehicle = nullptr;
 }
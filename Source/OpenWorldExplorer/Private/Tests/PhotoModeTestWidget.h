@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "PhotoModeTestWidget.generated.h"
+
+// Stands in for the viewfinder blueprint in automation tests, UUserWidget itself is abstract
+UCLASS(NotBlueprintable, HideDropdown)
+class UPhotoModeTestWidget : public UUserWidget
+{
+	GENERATED_BODY()
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "Misc/AutomationTest.h"
+#include "World/PhotographySystem.h"
+#include "Tests/PhotoModeTestWidget.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Enough actors that walking the world on entry or exit would show up in the timings
+static const int32 PhotoTimingWorldActors = 5000;
+static const int32 PhotoTimingIterations = 20;
+
+// Entering and leaving photo mode should only be a switch, the freeze and thaw happen in the frames after
+static const double MaxPhotoModeTransitionMs = 1.0;
+
+// Frames given to the spread out freeze or thaw before the test gives up on it
+static const int32 MaxPhotoSpreadFrames = 1000;
+static const float PhotoTimingFrameSeconds = 1.0f / 60.0f;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPhotoModeEnterExitTimingTest, "OpenWorldExplorer.Photography.EnterExitTiming",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPhotoModeEnterExitTimingTest::RunTest(const FString& Parameters)
+{
+    // A game mode is what begins play on the world's actors, without one the photography system never runs BeginPlay
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.OwningGameInstance = GameInstance;
+    WorldContext.SetCurrentWorld(World);
+    World->SetGameInstance(GameInstance);
+    World->GetWorldSettings()->DefaultGameMode = AGameModeBase::StaticClass();
+    World->SetGameMode(FURL());
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+    TestTrue(TEXT("World has begun play"), World->HasBegunPlay());
+    
+    World->SpawnActor<APlayerController>();
+    
+    // Ticking actors, never rendered, so the freeze stops every one of them
+    TArray<AActor*> WorldActors;
+    WorldActors.Reserve(PhotoTimingWorldActors);
+    for (int32 Index = 0; Index < PhotoTimingWorldActors; Index++)
+    {
+        AActor* Actor = World->SpawnActorDeferred<AActor>(AActor::StaticClass(), FTransform::Identity);
+        Actor->PrimaryActorTick.bCanEverTick = true;
+        Actor->FinishSpawning(FTransform::Identity);
+        WorldActors.Add(Actor);
+    }
+    
+    AActor* PhotoOwner = World->SpawnActor<AActor>();
+    UPhotographySystem* Photography = NewObject<UPhotographySystem>(PhotoOwner);
+    if (FClassProperty* ViewfinderProperty = FindFProperty<FClassProperty>(UPhotographySystem::StaticClass(), TEXT("ViewfinderWidgetClass")))
+    {
+        ViewfinderProperty->SetObjectPropertyValue_InContainer(Photography, UPhotoModeTestWidget::StaticClass());
+    }
+    Photography->RegisterComponent();
+    TestTrue(TEXT("Photography system has begun play"), Photography->HasBegunPlay());
+    
+    auto TickUntil = [World](TFunctionRef<bool()> IsDone)
+    {
+        int32 Frames = 0;
+        while (!IsDone() && Frames < MaxPhotoSpreadFrames)
+        {
+            World->Tick(LEVELTICK_All, PhotoTimingFrameSeconds);
+            ++Frames;
+        }
+        return Frames;
+    };
+    
+    auto CountTickingActors = [&WorldActors]()
+    {
+        int32 Ticking = 0;
+        for (AActor* Actor : WorldActors)
+        {
+            Ticking += Actor->IsActorTickEnabled() ? 1 : 0;
+        }
+        return Ticking;
+    };
+    
+    double EnterSeconds = 0.0;
+    double ExitSeconds = 0.0;
+    int32 FreezeFrames = 0;
+    int32 ThawFrames = 0;
+    for (int32 Iteration = 0; Iteration < PhotoTimingIterations; Iteration++)
+    {
+        double StartTime = FPlatformTime::Seconds();
+        Photography->EnterPhotoMode();
+        EnterSeconds += FPlatformTime::Seconds() - StartTime;
+        TestTrue(TEXT("Photo mode entered"), Photography->IsInPhotoMode());
+        TestTrue(TEXT("Freeze started"), Photography->IsFreezeInProgress());
+        
+        FreezeFrames += TickUntil([Photography]() { return !Photography->IsFreezeInProgress(); });
+        TestFalse(TEXT("Freeze finished"), Photography->IsFreezeInProgress());
+        TestEqual(TEXT("Offscreen actors stopped ticking"), CountTickingActors(), 0);
+        
+        StartTime = FPlatformTime::Seconds();
+        Photography->ExitPhotoMode();
+        ExitSeconds += FPlatformTime::Seconds() - StartTime;
+        TestFalse(TEXT("Photo mode exited"), Photography->IsInPhotoMode());
+        
+        ThawFrames += TickUntil([Photography]() { return !Photography->IsThawInProgress(); });
+        TestFalse(TEXT("Thaw finished"), Photography->IsThawInProgress());
+        TestEqual(TEXT("Every actor ticks again"), CountTickingActors(), PhotoTimingWorldActors);
+    }
+    
+    const double EnterMs = EnterSeconds * 1000.0 / PhotoTimingIterations;
+    const double ExitMs = ExitSeconds * 1000.0 / PhotoTimingIterations;
+    AddInfo(FString::Printf(TEXT("Enter %.3f ms, exit %.3f ms with %d actors, freeze over %d frames, thaw over %d frames"),
+        EnterMs, ExitMs, PhotoTimingWorldActors, FreezeFrames / PhotoTimingIterations, ThawFrames / PhotoTimingIterations));
+    TestTrue(FString::Printf(TEXT("Entering photo mode took %.3f ms"), EnterMs), EnterMs < MaxPhotoModeTransitionMs);
+    TestTrue(FString::Printf(TEXT("Exiting photo mode took %.3f ms"), ExitMs), ExitMs < MaxPhotoModeTransitionMs);
+    
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    
+    return true;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "Misc/AutomationTest.h"
+#include "World/PointOfInterestGrid.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// A fully explored map, POIs spread over 4 km square
+static const int32 PoiBenchmarkPoints = 10000;
+static const float PoiBenchmarkMapSize = 400000.0f;
+static const int32 PoiBenchmarkQueries = 2000;
+
+// Same range the photography system uses to name a location, and a radius query of that size
+static const float PoiBenchmarkQueryDistance = 50000.0f;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPointOfInterestGridBenchmark, "OpenWorldExplorer.World.PointOfInterestGridBenchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPointOfInterestGridBenchmark::RunTest(const FString& Parameters)
+{
+    FRandomStream Random(12345);
+    
+    auto RandomMapLocation = [&Random]()
+    {
+        return FVector(Random.FRandRange(0.0f, PoiBenchmarkMapSize), Random.FRandRange(0.0f, PoiBenchmarkMapSize), Random.FRandRange(-5000.0f, 5000.0f));
+    };
+    
+    TArray<FVector> Points;
+    FPointOfInterestGrid Grid;
+    for (int32 Id = 0; Id < PoiBenchmarkPoints; ++Id)
+    {
+        const FVector Location = RandomMapLocation();
+        Points.Add(Location);
+        Grid.Add(Id, Location);
+    }
+    TestEqual(TEXT("Grid holds every point"), Grid.Num(), PoiBenchmarkPoints);
+    
+    // Some queries fall off the map so empty results are covered too
+    TArray<FVector> Queries;
+    for (int32 Index = 0; Index < PoiBenchmarkQueries; ++Index)
+    {
+        Queries.Add(Index % 10 == 0 ? RandomMapLocation() * 1.5f - FVector(PoiBenchmarkMapSize * 0.25f) : RandomMapLocation());
+    }
+    
+    const float QueryDistanceSquared = PoiBenchmarkQueryDistance * PoiBenchmarkQueryDistance;
+    
+    // The linear scan the grid replaced
+    TArray<float> LinearNearest;
+    LinearNearest.SetNumUninitialized(Queries.Num());
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Queries.Num(); ++Index)
+    {
+        float ClosestDistanceSquared = MAX_flt;
+        for (const FVector& Point : Points)
+        {
+            ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, FVector::DistSquared(Queries[Index], Point));
+        }
+        LinearNearest[Index] = ClosestDistanceSquared <= QueryDistanceSquared ? ClosestDistanceSquared : -1.0f;
+    }
+    const double LinearNearestMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    TArray<float> GridNearest;
+    GridNearest.SetNumUninitialized(Queries.Num());
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Queries.Num(); ++Index)
+    {
+        float DistanceSquared = -1.0f;
+        Grid.FindNearest(Queries[Index], PoiBenchmarkQueryDistance, &DistanceSquared);
+        GridNearest[Index] = DistanceSquared;
+    }
+    const double GridNearestMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    // Ties may resolve to a different id, so the distance found is compared
+    for (int32 Index = 0; Index < Queries.Num(); ++Index)
+    {
+        if (GridNearest[Index] != LinearNearest[Index])
+        {
+            AddError(FString::Printf(TEXT("Nearest point to query %d is %f away in the grid but %f in a linear scan"), Index, GridNearest[Index], LinearNearest[Index]));
+            break;
+        }
+    }
+    
+    TArray<TArray<int32>> LinearInRadius;
+    LinearInRadius.SetNum(Queries.Num());
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Queries.Num(); ++Index)
+    {
+        for (int32 Id = 0; Id < Points.Num(); ++Id)
+        {
+            if (FVector::DistSquared(Queries[Index], Points[Id]) <= QueryDistanceSquared)
+            {
+                LinearInRadius[Index].Add(Id);
+            }
+        }
+    }
+    const double LinearRadiusMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    TArray<TArray<int32>> GridInRadius;
+    GridInRadius.SetNum(Queries.Num());
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Queries.Num(); ++Index)
+    {
+        TArray<int32>& Found = GridInRadius[Index];
+        Grid.ForEachInRadius(Queries[Index], PoiBenchmarkQueryDistance, [&Found](int32 Id, const FVector&)
+        {
+            Found.Add(Id);
+        });
+    }
+    const double GridRadiusMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    // Cells are visited in their own order, the linear results are already sorted by id
+    for (int32 Index = 0; Index < Queries.Num(); ++Index)
+    {
+        GridInRadius[Index].Sort();
+        if (GridInRadius[Index] != LinearInRadius[Index])
+        {
+            AddError(FString::Printf(TEXT("Query %d found %d points in radius in the grid but %d in a linear scan"), Index, GridInRadius[Index].Num(), LinearInRadius[Index].Num()));
+            break;
+        }
+    }
+    
+    AddInfo(FString::Printf(TEXT("%d queries over %d POIs: nearest %.2f ms grid vs %.2f ms linear, radius %.2f ms grid vs %.2f ms linear"),
+        Queries.Num(), PoiBenchmarkPoints, GridNearestMs, LinearNearestMs, GridRadiusMs, LinearRadiusMs));
+    TestTrue(TEXT("FindNearest is faster than a linear scan"), GridNearestMs < LinearNearestMs);
+    TestTrue(TEXT("ForEachInRadius is faster than a linear scan"), GridRadiusMs < LinearRadiusMs);
+    
+    return true;
+}
+
+#endif
\ No newline at end of file
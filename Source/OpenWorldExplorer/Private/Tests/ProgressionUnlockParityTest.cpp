@@ -0,0 +1,175 @@
+#include "Misc/AutomationTest.h"
+#include "World/ProgressionSystem.h"
+#include "Math/RandomStream.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Random unlock tables and event sequences played through the graph and the old rescan side by side
+static const int32 UnlockParitySeeds = 50;
+static const int32 UnlockParityEvents = 400;
+static const int32 UnlockParityVehicles = 24;
+static const int32 UnlockParityCustomizations = 48;
+static const int32 UnlockParityLocations = 32;
+static const int32 UnlockParityMaxRequiredPoints = 60000;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProgressionUnlockParityTest, "OpenWorldExplorer.Progression.UnlockGraphParity",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+// What the old CheckForUnlocks did, a full scan of every locked item against the current points and discoveries
+static void ScanUnlocks(const UProgressionSystem& Progression, const TArray<FVehicleUnlock>& Vehicles, const TArray<FCustomizationUnlock>& Customizations,
+    TArray<bool>& InOutVehicleUnlocked, TArray<bool>& InOutCustomizationUnlocked)
+{
+    const int32 Points = Progression.GetCurrentExplorationPoints();
+    
+    TSet<FString> Discovered;
+    for (const FDiscoveredLocation& Location : Progression.GetDiscoveredLocations())
+    {
+        Discovered.Add(Location.LocationName);
+    }
+    
+    for (int32 i = 0; i < Vehicles.Num(); ++i)
+    {
+        if (InOutVehicleUnlocked[i] || Points < Vehicles[i].RequiredExplorationPoints)
+            continue;
+        
+        bool bAllDiscoveriesFound = true;
+        for (const FString& RequiredDiscovery : Vehicles[i].RequiredDiscoveries)
+        {
+            if (!Discovered.Contains(RequiredDiscovery))
+            {
+                bAllDiscoveriesFound = false;
+                break;
+            }
+        }
+        InOutVehicleUnlocked[i] = bAllDiscoveriesFound;
+    }
+    
+    for (int32 i = 0; i < Customizations.Num(); ++i)
+    {
+        InOutCustomizationUnlocked[i] |= Points >= Customizations[i].RequiredExplorationPoints;
+    }
+}
+
+bool FProgressionUnlockParityTest::RunTest(const FString& Parameters)
+{
+    for (int32 Seed = 0; Seed < UnlockParitySeeds; ++Seed)
+    {
+        FRandomStream Random(Seed);
+        
+        // Never initialized, so the player's save slot is neither loaded nor written
+        UProgressionSystem* Progression = NewObject<UProgressionSystem>(GetTransientPackage());
+        
+        TArray<FString> LocationNames;
+        for (int32 i = 0; i < UnlockParityLocations; ++i)
+        {
+            LocationNames.Add(FString::Printf(TEXT("ParityLocation%d"), i));
+        }
+        
+        for (int32 i = 0; i < UnlockParityVehicles; ++i)
+        {
+            FVehicleUnlock& Vehicle = Progression->VehicleUnlocks.AddDefaulted_GetRef();
+            Vehicle.VehicleName = FString::Printf(TEXT("ParityVehicle%d"), i);
+            Vehicle.bIsUnlocked = Random.FRand() < 0.1f;
+            Vehicle.RequiredExplorationPoints = Random.RandRange(0, UnlockParityMaxRequiredPoints);
+            
+            // Repeats included, a vehicle listing the same location twice waits on it once
+            const int32 NumDiscoveries = Random.RandRange(0, 4);
+            for (int32 d = 0; d < NumDiscoveries; ++d)
+            {
+                Vehicle.RequiredDiscoveries.Add(LocationNames[Random.RandRange(0, UnlockParityLocations - 1)]);
+            }
+        }
+        
+        for (int32 i = 0; i < UnlockParityCustomizations; ++i)
+        {
+            FCustomizationUnlock& Customization = Progression->CustomizationUnlocks.AddDefaulted_GetRef();
+            Customization.UnlockName = FString::Printf(TEXT("ParityCustomization%d"), i);
+            Customization.Category = TEXT("Vehicle");
+            Customization.ItemType = TEXT("Paint");
+            Customization.ItemID = FString::Printf(TEXT("%d"), i);
+            Customization.bIsUnlocked = Random.FRand() < 0.1f;
+            Customization.RequiredExplorationPoints = Random.RandRange(0, UnlockParityMaxRequiredPoints);
+        }
+        
+        // Some locations already found, as if loaded from a save
+        for (int32 i = 0; i < UnlockParityLocations; ++i)
+        {
+            if (Random.FRand() < 0.2f)
+            {
+                FDiscoveredLocation& Location = Progression->DiscoveredLocations.AddDefaulted_GetRef();
+                Location.LocationName = LocationNames[i];
+                Location.LocationCoordinates = FVector(i * 1000.0f, 0.0f, 0.0f);
+            }
+        }
+        
+        // Copies of the authored tables, the old scan works on its own unlock flags
+        const TArray<FVehicleUnlock> Vehicles = Progression->VehicleUnlocks;
+        const TArray<FCustomizationUnlock> Customizations = Progression->CustomizationUnlocks;
+        TArray<bool> OldVehicleUnlocked;
+        TArray<bool> OldCustomizationUnlocked;
+        for (const FVehicleUnlock& Vehicle : Vehicles)
+        {
+            OldVehicleUnlocked.Add(Vehicle.bIsUnlocked);
+        }
+        for (const FCustomizationUnlock& Customization : Customizations)
+        {
+            OldCustomizationUnlocked.Add(Customization.bIsUnlocked);
+        }
+        
+        // Same steps as Initialize after a load
+        Progression->RebuildLookupIndices();
+        Progression->RebuildUnlockGraph();
+        Progression->CheckForUnlocks();
+        
+        // The old code only scanned after a discovery or a level up. The graph is cheap enough to check on every award,
+        // so in between it may be ahead of the old scan but never behind, and a scan right now always agrees with it.
+        for (int32 Event = 0; Event < UnlockParityEvents && !HasAnyErrors(); ++Event)
+        {
+            const int32 LevelBefore = Progression->GetExplorationLevel();
+            const bool bDiscovery = Random.FRand() < 0.4f;
+            
+            if (bDiscovery)
+            {
+                const int32 LocationIndex = Random.RandRange(0, UnlockParityLocations - 1);
+                Progression->RegisterDiscoveredLocation(LocationNames[LocationIndex], FVector(LocationIndex * 1000.0f, 0.0f, 0.0f));
+            }
+            else
+            {
+                // Photos, distance and achievement rewards, none of which rescanned unless the level went up
+                Progression->AwardExplorationPoints(Random.RandRange(10, 600));
+            }
+            
+            if (bDiscovery || Progression->GetExplorationLevel() > LevelBefore)
+            {
+                ScanUnlocks(*Progression, Vehicles, Customizations, OldVehicleUnlocked, OldCustomizationUnlocked);
+            }
+            
+            TArray<bool> ScanVehicleUnlocked = OldVehicleUnlocked;
+            TArray<bool> ScanCustomizationUnlocked = OldCustomizationUnlocked;
+            ScanUnlocks(*Progression, Vehicles, Customizations, ScanVehicleUnlocked, ScanCustomizationUnlocked);
+            
+            for (int32 i = 0; i < Vehicles.Num(); ++i)
+            {
+                const bool bUnlocked = Progression->VehicleUnlocks[i].bIsUnlocked;
+                TestEqual(FString::Printf(TEXT("Seed %d event %d: %s matches a rescan"), Seed, Event, *Vehicles[i].VehicleName), bUnlocked, ScanVehicleUnlocked[i]);
+                TestTrue(FString::Printf(TEXT("Seed %d event %d: %s is unlocked no later than before"), Seed, Event, *Vehicles[i].VehicleName), bUnlocked || !OldVehicleUnlocked[i]);
+            }
+            
+            for (int32 i = 0; i < Customizations.Num(); ++i)
+            {
+                const bool bUnlocked = Progression->CustomizationUnlocks[i].bIsUnlocked;
+                TestEqual(FString::Printf(TEXT("Seed %d event %d: %s matches a rescan"), Seed, Event, *Customizations[i].UnlockName), bUnlocked, ScanCustomizationUnlocked[i]);
+                TestTrue(FString::Printf(TEXT("Seed %d event %d: %s is unlocked no later than before"), Seed, Event, *Customizations[i].UnlockName), bUnlocked || !OldCustomizationUnlocked[i]);
+            }
+        }
+        
+        // Stop it ticking, it must never flush the save requests made above
+        Progression->bSaveDirty = false;
+        Progression->MarkPendingKill();
+    }
+    
+    return true;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "Misc/AutomationTest.h"
+#include "World/WorldServicesSubsystem.h"
+#include "World/WorldManager.h"
+#include "World/PhotoGallerySubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/WorldSettings.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Other actors in the world, GetActorOfClass has to look past them
+static const int32 LookupBenchmarkWorldActors = 5000;
+static const int32 LookupBenchmarkIterations = 100000;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWorldServicesLookupBenchmark, "OpenWorldExplorer.World.ServiceLookupBenchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FWorldServicesLookupBenchmark::RunTest(const FString& Parameters)
+{
+    // Game instance subsystems only exist once the instance is initialized, and the world manager only registers on BeginPlay
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+    GameInstance->Init();
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.OwningGameInstance = GameInstance;
+    WorldContext.SetCurrentWorld(World);
+    World->SetGameInstance(GameInstance);
+    World->GetWorldSettings()->DefaultGameMode = AGameModeBase::StaticClass();
+    World->SetGameMode(FURL());
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+    
+    for (int32 Index = 0; Index < LookupBenchmarkWorldActors; Index++)
+    {
+        World->SpawnActor<AActor>();
+    }
+    AWorldManager* WorldManager = World->SpawnActor<AWorldManager>();
+    
+    // Lookups are made from a component's point of view, as the photography system does
+    const AActor* Context = World->SpawnActor<AActor>();
+    
+    UWorldServicesSubsystem* WorldServices = UWorldServicesSubsystem::Get(Context);
+    TestNotNull(TEXT("World services exist"), WorldServices);
+    TestNotNull(TEXT("World manager spawned"), WorldManager);
+    if (!WorldServices || !WorldManager)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+        GameInstance->Shutdown();
+        return false;
+    }
+    
+    // Each loop checks every result so the lookups can't be optimized away
+    int32 Mismatches = 0;
+    
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < LookupBenchmarkIterations; Iteration++)
+    {
+        Mismatches += UWorldServicesSubsystem::Get(Context)->GetWorldManager() != WorldManager;
+    }
+    const double ServicesManagerMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < LookupBenchmarkIterations; Iteration++)
+    {
+        Mismatches += UGameplayStatics::GetActorOfClass(Context, AWorldManager::StaticClass()) != WorldManager;
+    }
+    const double ActorOfClassMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(TEXT("Both lookups find the world manager"), Mismatches, 0);
+    
+    UPhotoGallerySubsystem* Gallery = GameInstance->GetSubsystem<UPhotoGallerySubsystem>();
+    TestNotNull(TEXT("Photo gallery exists"), Gallery);
+    Mismatches = 0;
+    
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < LookupBenchmarkIterations; Iteration++)
+    {
+        Mismatches += UWorldServicesSubsystem::Get(Context)->GetPhotoGallery() != Gallery;
+    }
+    const double ServicesGalleryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < LookupBenchmarkIterations; Iteration++)
+    {
+        Mismatches += UGameplayStatics::GetGameInstance(Context)->GetSubsystem<UPhotoGallerySubsystem>() != Gallery;
+    }
+    const double GameInstanceGalleryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(TEXT("Both lookups find the photo gallery"), Mismatches, 0);
+    
+    AddInfo(FString::Printf(TEXT("%d lookups with %d actors: world manager %.2f ms services vs %.2f ms GetActorOfClass, gallery %.2f ms services vs %.2f ms game instance subsystem"),
+        LookupBenchmarkIterations, LookupBenchmarkWorldActors, ServicesManagerMs, ActorOfClassMs, ServicesGalleryMs, GameInstanceGalleryMs));
+    TestTrue(TEXT("World services find the world manager faster than GetActorOfClass"), ServicesManagerMs < ActorOfClassMs);
+    
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    GameInstance->Shutdown();
+    
+    return true;
+}
+
+#endif
\ No newline at end of file
@@ -6,10 +6,18 @@
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "ChaosWheeledVehicleMovementComponent.h"
-#include "Characters/ExplorerCharacter.h"
 #include "GameFramework/PlayerController.h"
-#include "World/ProgressionSystem.h"
-#include "Kismet/GameplayStatics.h"
+#include "Vehicles/VehicleOdometerComponent.h"
+#include "Vehicles/VehicleRegistrySubsystem.h"
+#include "Vehicles/PawnHandoffSubsystem.h"
+#include "Vehicles/VehicleEngineAudioComponent.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Math/VectorRegister.h"
+#include "OpenWorldExplorer.h"
+
+DECLARE_CYCLE_STAT(TEXT("Vehicle Surface Response"), STAT_VehicleSurfaceResponse, STATGROUP_OpenWorldExplorer);
+DECLARE_CYCLE_STAT(TEXT("Vehicle Input Flush"), STAT_VehicleInputFlush, STATGROUP_OpenWorldExplorer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Vehicles"), STAT_DormantVehicles, STATGROUP_OpenWorldExplorer);
 
 ABaseVehicle::ABaseVehicle()
 {
@@ -19,6 +27,7 @@ ABaseVehicle::ABaseVehicle()
     VehicleMesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("VehicleMesh"));
     RootComponent = VehicleMesh;
     VehicleMesh->SetCollisionProfileName(TEXT("Vehicle"));
+    VehicleMesh->BodyInstance.bGenerateWakeEvents = true;
 
     // Create the vehicle movement component
     VehicleMovement = CreateDefaultSubobject<UChaosWheeledVehicleMovementComponent>(TEXT("VehicleMovement"));
@@ -41,52 +50,104 @@ ABaseVehicle::ABaseVehicle()
     FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
     FollowCamera->bUsePawnControlRotation = false;
 
+    // Distance tracking for the progression system
+    Odometer = CreateDefaultSubobject<UVehicleOdometerComponent>(TEXT("Odometer"));
+
     // Set default properties
     MaxSpeed = 200.0f; // km/h
     Acceleration = 10.0f;
     BrakingForce = 10.0f;
     TurnRate = 5.0f;
     bIsFirstPersonView = false;
+    Significance = EVehicleSignificance::High;
+    EngineAudio = nullptr;
+    
+    // Matches the physical surfaces in DefaultEngine.ini
+    PhysicalSurfaceMap.Add(SurfaceType1, EVehicleSurface::Dirt);
+    PhysicalSurfaceMap.Add(SurfaceType2, EVehicleSurface::Grass);
+    PhysicalSurfaceMap.Add(SurfaceType3, EVehicleSurface::Sand);
+    PhysicalSurfaceMap.Add(SurfaceType4, EVehicleSurface::Snow);
+    PhysicalSurfaceMap.Add(SurfaceType5, EVehicleSurface::Ice);
+    PhysicalSurfaceMap.Add(SurfaceType6, EVehicleSurface::Water);
+    
+    // Off-road surfaces
+    FVehicleSurfaceResponse Offroad;
+    Offroad.ThrottleMultiplier = 0.8f;
+    Offroad.TractionMultiplier = 0.8f;
+    Offroad.RollingResistance = 0.04f;
+    SurfaceResponses.Add(EVehicleSurface::Road, FVehicleSurfaceResponse());
+    SurfaceResponses.Add(EVehicleSurface::Dirt, Offroad);
+    SurfaceResponses.Add(EVehicleSurface::Grass, Offroad);
+    Offroad.RollingResistance = 0.1f;
+    SurfaceResponses.Add(EVehicleSurface::Sand, Offroad);
+    
+    // Slippery surfaces - reduce throttle to prevent wheel spin and steering sensitivity
+    FVehicleSurfaceResponse Slippery;
+    Slippery.ThrottleMultiplier = 0.6f;
+    Slippery.SteeringMultiplier = 0.7f;
+    Slippery.TractionMultiplier = 0.5f;
+    Slippery.RollingResistance = 0.03f;
+    SurfaceResponses.Add(EVehicleSurface::Snow, Slippery);
+    Slippery.TractionMultiplier = 0.3f;
+    Slippery.RollingResistance = 0.01f;
+    SurfaceResponses.Add(EVehicleSurface::Ice, Slippery);
+    
+    // Water crossing - maintain momentum but don't allow too much power
+    FVehicleSurfaceResponse Water;
+    Water.MaxThrottle = 0.5f;
+    Water.TractionMultiplier = 0.6f;
+    Water.RollingResistance = 0.15f;
+    SurfaceResponses.Add(EVehicleSurface::Water, Water);
+    
+    FMemory::Memzero(WheelSurfaces);
+    for (int32 WheelIdx = 0; WheelIdx < FWheelSurfaceBlock::MaxWheels; WheelIdx++)
+    {
+        AppliedWheelFriction[WheelIdx] = 1.0f;
+    }
+    CurrentSurface = EVehicleSurface::Road;
+    SurfaceThrottleScale = 1.0f;
+    SurfaceSteeringScale = 1.0f;
+    SurfaceMaxThrottle = 1.0f;
+    RebuildSurfaceTables();
     
     // Set this pawn to be controlled by the player
     AutoPossessPlayer = EAutoReceiveInput::Player0;
     
     // Default setup for vehicle simulation
-    UChaosWheeledVehicleMovementComponent* WheeledMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-    if (WheeledMovement)
+    if (VehicleMovement)
     {
         // Set up the chassis
-        WheeledMovement->ChassisHeight = 100.0f;
-        WheeledMovement->DragCoefficient = 0.3f;
+        VehicleMovement->ChassisHeight = 100.0f;
+        VehicleMovement->DragCoefficient = 0.3f;
         
         // Set up the engine
-        WheeledMovement->EngineSetup.TorqueCurve.GetRichCurve()->Reset();
-        WheeledMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(0.0f, 400.0f);
-        WheeledMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(2000.0f, 500.0f);
-        WheeledMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(4000.0f, 600.0f);
-        WheeledMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(6000.0f, 500.0f);
-        WheeledMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(8000.0f, 400.0f);
-        WheeledMovement->EngineSetup.MaxRPM = 8000.0f;
+        VehicleMovement->EngineSetup.TorqueCurve.GetRichCurve()->Reset();
+        VehicleMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(0.0f, 400.0f);
+        VehicleMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(2000.0f, 500.0f);
+        VehicleMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(4000.0f, 600.0f);
+        VehicleMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(6000.0f, 500.0f);
+        VehicleMovement->EngineSetup.TorqueCurve.GetRichCurve()->AddKey(8000.0f, 400.0f);
+        VehicleMovement->EngineSetup.MaxRPM = 8000.0f;
         
         // Set up transmission
-        WheeledMovement->TransmissionSetup.GearSwitchTime = 0.15f;
-        WheeledMovement->TransmissionSetup.GearAutoBoxLatency = 1.0f;
-        WheeledMovement->TransmissionSetup.FinalRatio = 3.5f;
+        VehicleMovement->TransmissionSetup.GearSwitchTime = 0.15f;
+        VehicleMovement->TransmissionSetup.GearAutoBoxLatency = 1.0f;
+        VehicleMovement->TransmissionSetup.FinalRatio = 3.5f;
         
         // Forward gears
-        WheeledMovement->TransmissionSetup.ForwardGears.SetNum(6);
-        WheeledMovement->TransmissionSetup.ForwardGears[0].Ratio = 4.25f;
-        WheeledMovement->TransmissionSetup.ForwardGears[1].Ratio = 2.52f;
-        WheeledMovement->TransmissionSetup.ForwardGears[2].Ratio = 1.66f;
-        WheeledMovement->TransmissionSetup.ForwardGears[3].Ratio = 1.22f;
-        WheeledMovement->TransmissionSetup.ForwardGears[4].Ratio = 1.0f;
-        WheeledMovement->TransmissionSetup.ForwardGears[5].Ratio = 0.82f;
+        VehicleMovement->TransmissionSetup.ForwardGears.SetNum(6);
+        VehicleMovement->TransmissionSetup.ForwardGears[0].Ratio = 4.25f;
+        VehicleMovement->TransmissionSetup.ForwardGears[1].Ratio = 2.52f;
+        VehicleMovement->TransmissionSetup.ForwardGears[2].Ratio = 1.66f;
+        VehicleMovement->TransmissionSetup.ForwardGears[3].Ratio = 1.22f;
+        VehicleMovement->TransmissionSetup.ForwardGears[4].Ratio = 1.0f;
+        VehicleMovement->TransmissionSetup.ForwardGears[5].Ratio = 0.82f;
         
         // Set up the steering
-        WheeledMovement->SteeringSetup.SteeringCurve.GetRichCurve()->Reset();
-        WheeledMovement->SteeringSetup.SteeringCurve.GetRichCurve()->AddKey(0.0f, 1.0f);
-        WheeledMovement->SteeringSetup.SteeringCurve.GetRichCurve()->AddKey(100.0f, 0.8f);
-        WheeledMovement->SteeringSetup.SteeringCurve.GetRichCurve()->AddKey(200.0f, 0.4f);
+        VehicleMovement->SteeringSetup.SteeringCurve.GetRichCurve()->Reset();
+        VehicleMovement->SteeringSetup.SteeringCurve.GetRichCurve()->AddKey(0.0f, 1.0f);
+        VehicleMovement->SteeringSetup.SteeringCurve.GetRichCurve()->AddKey(100.0f, 0.8f);
+        VehicleMovement->SteeringSetup.SteeringCurve.GetRichCurve()->AddKey(200.0f, 0.4f);
     }
 }
 
@@ -94,6 +155,9 @@ void ABaseVehicle::BeginPlay()
 {
     Super::BeginPlay();
     
+    // Pick up edits made to the surface maps in the editor
+    RebuildSurfaceTables();
+    
     // Set up Enhanced Input for the player controller
     if (APlayerController* PlayerController = Cast<APlayerController>(GetController()))
     {
@@ -103,29 +167,121 @@ void ABaseVehicle::BeginPlay()
             Subsystem->AddMappingContext(VehicleMappingContext, 0);
         }
     }
+    
+    EngineAudio = FindComponentByClass<UVehicleEngineAudioComponent>();
+    VehicleMesh->OnComponentWake.AddDynamic(this, &ABaseVehicle::OnBodyWake);
+    
+    if (UVehicleRegistrySubsystem* VehicleRegistry = GetWorld()->GetSubsystem<UVehicleRegistrySubsystem>())
+    {
+        VehicleRegistry->RegisterVehicle(this);
+    }
 }
 
-void ABaseVehicle::Tick(float DeltaTime)
+void ABaseVehicle::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
+    if (UVehicleRegistrySubsystem* VehicleRegistry = GetWorld()->GetSubsystem<UVehicleRegistrySubsystem>())
+    {
+        VehicleRegistry->UnregisterVehicle(this);
+    }
+    
+    if (Significance == EVehicleSignificance::Dormant)
+    {
+        DEC_DWORD_STAT(STAT_DormantVehicles);
+    }
+    
+    Super::EndPlay(EndPlayReason);
+}
 
-    // Track distance traveled for progression system
-    static FVector LastLocation = GetActorLocation();
-    float DistanceTraveled = FVector::Distance(GetActorLocation(), LastLocation) / 100.0f; // Convert to meters
+void ABaseVehicle::PossessedBy(AController* NewController)
+{
+    Super::PossessedBy(NewController);
     
-    // Update progression system with distance traveled
-    if (DistanceTraveled > 0.01f) // Only register meaningful movement
+    // Input handled by the controller this frame should be flushed in our tick, not the next one
+    AddTickPrerequisiteActor(NewController);
+    
+    // Don't wait for the round robin, the player is about to drive
+    if (UVehicleSignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UVehicleSignificanceSubsystem>())
     {
-        UProgressionSystem* ProgressionSystem = Cast<UProgressionSystem>(UGameplayStatics::GetGameInstance(this)->GetSubsystem<UProgressionSystem>());
-        if (ProgressionSystem)
-        {
-            ProgressionSystem->RegisterDistanceTraveled(DistanceTraveled, true);
-        }
-        
-        LastLocation = GetActorLocation();
+        SignificanceSubsystem->RefreshVehicle(this);
+    }
+}
+
+void ABaseVehicle::UnPossessed()
+{
+    // Parked or handed to someone else, it no longer waits on this controller's tick
+    if (Controller)
+    {
+        RemoveTickPrerequisiteActor(Controller);
+    }
+    
+    Super::UnPossessed();
+}
+
+void ABaseVehicle::SetSignificance(EVehicleSignificance NewSignificance)
+{
+    if (NewSignificance == Significance)
+        return;
+    
+    const bool bWasDormant = Significance == EVehicleSignificance::Dormant;
+    const bool bDormant = NewSignificance == EVehicleSignificance::Dormant;
+    Significance = NewSignificance;
+    
+    const FVehicleSignificanceTier& Tier = UVehicleSignificanceSubsystem::GetTierSettings(NewSignificance);
+    SetActorTickInterval(Tier.TickInterval);
+    VehicleMesh->SetComponentTickInterval(Tier.MeshTickInterval);
+    VehicleMesh->VisibilityBasedAnimTickOption = Tier.AnimTickOption;
+    
+    if (bDormant == bWasDormant)
+        return;
+    
+    // Parked vehicles only need to render, anything that touches them wakes the body and OnBodyWake the rest
+    SetActorTickEnabled(!bDormant);
+    VehicleMesh->SetComponentTickEnabled(!bDormant);
+    VehicleMovement->SetComponentTickEnabled(!bDormant);
+    Odometer->SetComponentTickEnabled(!bDormant);
+    if (EngineAudio)
+    {
+        EngineAudio->SetDormant(bDormant);
+    }
+    
+    if (bDormant)
+    {
+        VehicleMesh->PutAllRigidBodiesToSleep();
+        INC_DWORD_STAT(STAT_DormantVehicles);
+    }
+    else
+    {
+        VehicleMesh->WakeAllRigidBodies();
+        DEC_DWORD_STAT(STAT_DormantVehicles);
     }
 }
 
+bool ABaseVehicle::IsAtRest(float SpeedThreshold) const
+{
+    if (VehicleMesh->GetPhysicsLinearVelocity().SizeSquared() > FMath::Square(SpeedThreshold))
+        return false;
+    
+    // Wheels report no contact until the first simulation step, so fresh spawns are never parked in the air
+    if (!VehicleMovement || VehicleMovement->Wheels.Num() == 0)
+        return false;
+    
+    for (int32 WheelIdx = 0; WheelIdx < VehicleMovement->Wheels.Num(); WheelIdx++)
+    {
+        if (!VehicleMovement->GetWheelState(WheelIdx).bInContact)
+            return false;
+    }
+    
+    return true;
+}
+
+void ABaseVehicle::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    
+    UpdateSurfaceResponse(DeltaTime);
+    FlushInput();
+}
+
 void ABaseVehicle::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
     Super::SetupPlayerInputComponent(PlayerInputComponent);
@@ -199,49 +355,75 @@ void ABaseVehicle::ProcessHandbrakeInput(const FInputActionValue& Value)
 
 void ABaseVehicle::ApplyThrottle(float Value)
 {
-    if (VehicleMovement)
-    {
-        UChaosWheeledVehicleMovementComponent* WheeledMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-        if (WheeledMovement)
-        {
-            WheeledMovement->SetThrottleInput(Value);
-        }
-    }
+    PendingInput.Throttle = Value;
+    WakeForInput();
 }
 
 void ABaseVehicle::ApplySteering(float Value)
 {
-    if (VehicleMovement)
+    PendingInput.Steering = Value;
+    WakeForInput();
+}
+
+void ABaseVehicle::ApplyBrake(float Value)
+{
+    PendingInput.Brake = Value;
+    WakeForInput();
+}
+
+void ABaseVehicle::ApplyHandbrake(bool bEnabled)
+{
+    PendingInput.bHandbrake = bEnabled;
+    WakeForInput();
+}
+
+void ABaseVehicle::WakeForInput()
+{
+    // A parked vehicle doesn't tick, so nothing would flush the input
+    if (Significance == EVehicleSignificance::Dormant)
     {
-        UChaosWheeledVehicleMovementComponent* WheeledMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-        if (WheeledMovement)
-        {
-            WheeledMovement->SetSteeringInput(Value);
-        }
+        SetSignificance(EVehicleSignificance::Low);
     }
 }
 
-void ABaseVehicle::ApplyBrake(float Value)
+void ABaseVehicle::OnBodyWake(UPrimitiveComponent* WakingComponent, FName BoneName)
 {
-    if (VehicleMovement)
+    if (Significance == EVehicleSignificance::Dormant)
     {
-        UChaosWheeledVehicleMovementComponent* WheeledMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-        if (WheeledMovement)
-        {
-            WheeledMovement->SetBrakeInput(Value);
-        }
+        SetSignificance(EVehicleSignificance::Low);
     }
 }
 
-void ABaseVehicle::ApplyHandbrake(bool bEnabled)
+void ABaseVehicle::FlushInput()
 {
-    if (VehicleMovement)
+    SCOPE_CYCLE_COUNTER(STAT_VehicleInputFlush);
+    
+    // Surface modifiers are applied once per frame to the latest input, however many events arrived
+    const float Throttle = FMath::Clamp(PendingInput.Throttle * SurfaceThrottleScale, -SurfaceMaxThrottle, SurfaceMaxThrottle);
+    const float Steering = PendingInput.Steering * SurfaceSteeringScale;
+    
+    if (Throttle != AppliedInput.Throttle)
     {
-        UChaosWheeledVehicleMovementComponent* WheeledMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-        if (WheeledMovement)
-        {
-            WheeledMovement->SetHandbrakeInput(bEnabled);
-        }
+        VehicleMovement->SetThrottleInput(Throttle);
+        AppliedInput.Throttle = Throttle;
+    }
+    
+    if (Steering != AppliedInput.Steering)
+    {
+        VehicleMovement->SetSteeringInput(Steering);
+        AppliedInput.Steering = Steering;
+    }
+    
+    if (PendingInput.Brake != AppliedInput.Brake)
+    {
+        VehicleMovement->SetBrakeInput(PendingInput.Brake);
+        AppliedInput.Brake = PendingInput.Brake;
+    }
+    
+    if (PendingInput.bHandbrake != AppliedInput.bHandbrake)
+    {
+        VehicleMovement->SetHandbrakeInput(PendingInput.bHandbrake);
+        AppliedInput.bHandbrake = PendingInput.bHandbrake;
     }
 }
 
@@ -273,19 +455,147 @@ void ABaseVehicle::ExitVehicle()
         return;
     }
     
-    // Create and possess a new character
-    FVector SpawnLocation = GetActorLocation() + GetActorRightVector() * 200.0f;
-    FRotator SpawnRotation = GetActorRotation();
+    // Hand control back to whoever got in, once a free spot beside us is found
+    if (UPawnHandoffSubsystem* Handoff = GetWorld()->GetSubsystem<UPawnHandoffSubsystem>())
+    {
+        Handoff->RequestExit(this);
+    }
+}
+
+void ABaseVehicle::RebuildSurfaceTables(const TMap<EVehicleSurface, FVehicleSurfaceResponse>* Overrides)
+{
+    for (int32 SurfaceType = 0; SurfaceType < SurfaceType_Max; SurfaceType++)
+    {
+        SurfaceByPhysicalSurface[SurfaceType] = EVehicleSurface::Road;
+    }
     
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    for (const TPair<TEnumAsByte<EPhysicalSurface>, EVehicleSurface>& Mapping : PhysicalSurfaceMap)
+    {
+        if (Mapping.Value < EVehicleSurface::Count)
+        {
+            SurfaceByPhysicalSurface[Mapping.Key.GetValue()] = Mapping.Value;
+        }
+    }
+    
+    for (int32 Surface = 0; Surface < (int32)EVehicleSurface::Count; Surface++)
+    {
+        const FVehicleSurfaceResponse* Response = Overrides ? Overrides->Find((EVehicleSurface)Surface) : nullptr;
+        if (!Response)
+        {
+            Response = SurfaceResponses.Find((EVehicleSurface)Surface);
+        }
+        ActiveSurfaceResponses[Surface] = Response ? *Response : FVehicleSurfaceResponse();
+    }
+}
+
+void ABaseVehicle::UpdateSurfaceResponse(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VehicleSurfaceResponse);
+    
+    if (!VehicleMovement)
+        return;
+    
+    const int32 NumWheels = FMath::Min(VehicleMovement->Wheels.Num(), (int32)FWheelSurfaceBlock::MaxWheels);
+    const int32 NumLanes = Align(NumWheels, 4);
+    int32 SurfaceWheelCount[(int32)EVehicleSurface::Count] = {};
+    
+    // Gather each wheel's surface response into its lane, spare lanes stay off the ground
+    for (int32 WheelIdx = 0; WheelIdx < NumLanes; WheelIdx++)
+    {
+        const FWheelStatus* WheelState = WheelIdx < NumWheels ? &VehicleMovement->GetWheelState(WheelIdx) : nullptr;
+        const bool bInContact = WheelState && WheelState->bInContact;
+        
+        EVehicleSurface Surface = EVehicleSurface::Road;
+        if (bInContact)
+        {
+            const UPhysicalMaterial* PhysMat = WheelState->PhysMaterial.Get();
+            Surface = SurfaceByPhysicalSurface[PhysMat ? PhysMat->SurfaceType.GetValue() : SurfaceType_Default];
+            ++SurfaceWheelCount[(int32)Surface];
+        }
+        
+        const FVehicleSurfaceResponse& Response = ActiveSurfaceResponses[(int32)Surface];
+        WheelSurfaces.Contact[WheelIdx] = bInContact ? 1.0f : 0.0f;
+        WheelSurfaces.Traction[WheelIdx] = Response.TractionMultiplier;
+        WheelSurfaces.RollingResistance[WheelIdx] = Response.RollingResistance;
+        WheelSurfaces.Throttle[WheelIdx] = Response.ThrottleMultiplier;
+        WheelSurfaces.Steering[WheelIdx] = Response.SteeringMultiplier;
+        WheelSurfaces.MaxThrottle[WheelIdx] = Response.MaxThrottle;
+    }
+    
+    // Wheels in the air keep full friction, grounded ones take their surface's, and the rest is summed over contacts
+    const VectorRegister One = VectorOne();
+    VectorRegister ContactSum = VectorZero();
+    VectorRegister RollingSum = VectorZero();
+    VectorRegister ThrottleSum = VectorZero();
+    VectorRegister SteeringSum = VectorZero();
+    VectorRegister MaxThrottleSum = VectorZero();
+    
+    for (int32 Lane = 0; Lane < NumLanes; Lane += 4)
+    {
+        const VectorRegister Contact = VectorLoadAligned(&WheelSurfaces.Contact[Lane]);
+        const VectorRegister Traction = VectorLoadAligned(&WheelSurfaces.Traction[Lane]);
+        VectorStoreAligned(VectorMultiplyAdd(VectorSubtract(Traction, One), Contact, One), &WheelSurfaces.Traction[Lane]);
+        
+        ContactSum = VectorAdd(ContactSum, Contact);
+        RollingSum = VectorMultiplyAdd(VectorLoadAligned(&WheelSurfaces.RollingResistance[Lane]), Contact, RollingSum);
+        ThrottleSum = VectorMultiplyAdd(VectorLoadAligned(&WheelSurfaces.Throttle[Lane]), Contact, ThrottleSum);
+        SteeringSum = VectorMultiplyAdd(VectorLoadAligned(&WheelSurfaces.Steering[Lane]), Contact, SteeringSum);
+        MaxThrottleSum = VectorMultiplyAdd(VectorLoadAligned(&WheelSurfaces.MaxThrottle[Lane]), Contact, MaxThrottleSum);
+    }
+    
+    alignas(16) float Sums[5][4];
+    VectorStoreAligned(ContactSum, Sums[0]);
+    VectorStoreAligned(RollingSum, Sums[1]);
+    VectorStoreAligned(ThrottleSum, Sums[2]);
+    VectorStoreAligned(SteeringSum, Sums[3]);
+    VectorStoreAligned(MaxThrottleSum, Sums[4]);
+    
+    float Totals[5];
+    for (int32 Index = 0; Index < 5; Index++)
+    {
+        Totals[Index] = Sums[Index][0] + Sums[Index][1] + Sums[Index][2] + Sums[Index][3];
+    }
+    
+    // Send friction to the movement component in one pass, skipping wheels that haven't changed
+    for (int32 WheelIdx = 0; WheelIdx < NumWheels; WheelIdx++)
+    {
+        const float Friction = WheelSurfaces.Traction[WheelIdx];
+        if (!FMath::IsNearlyEqual(Friction, AppliedWheelFriction[WheelIdx], 0.01f))
+        {
+            VehicleMovement->SetWheelFrictionMultiplier(WheelIdx, Friction);
+            AppliedWheelFriction[WheelIdx] = Friction;
+        }
+    }
+    
+    // Keep the last response while airborne so landing doesn't change handling for a frame
+    const float WheelsInContact = Totals[0];
+    if (WheelsInContact <= 0.0f)
+        return;
+    
+    SurfaceThrottleScale = Totals[2] / WheelsInContact;
+    SurfaceSteeringScale = Totals[3] / WheelsInContact;
+    SurfaceMaxThrottle = Totals[4] / WheelsInContact;
+    
+    int32 BestSurface = 0;
+    for (int32 Surface = 1; Surface < (int32)EVehicleSurface::Count; Surface++)
+    {
+        if (SurfaceWheelCount[Surface] > SurfaceWheelCount[BestSurface])
+        {
+            BestSurface = Surface;
+        }
+    }
+    CurrentSurface = (EVehicleSurface)BestSurface;
     
-    AExplorerCharacter* Character = GetWorld()->SpawnActor<AExplorerCharacter>(AExplorerCharacter::StaticClass(), SpawnLocation, SpawnRotation, SpawnParams);
-    if (Character)
+    // Each wheel carries an equal share of the weight, rolling resistance drags against that share.
+    // Applied as an impulse over the time since our last tick so slower significance tiers get the same drag,
+    // capped so a long interval can't push the vehicle backwards.
+    const FVector Velocity = VehicleMesh->GetPhysicsLinearVelocity();
+    if (Totals[1] > 0.0f && NumWheels > 0 && !Velocity.IsNearlyZero(1.0f))
     {
-        // Unpossess the vehicle and possess the character
-        PlayerController->UnPossess();
-        PlayerController->Possess(Character);
+        const float Mass = VehicleMesh->GetMass();
+        const float WheelLoad = Mass * FMath::Abs(GetWorld()->GetGravityZ()) / NumWheels;
+        const float Impulse = FMath::Min(Totals[1] * WheelLoad * DeltaTime, Mass * Velocity.Size());
+        VehicleMesh->AddImpulse(-Velocity.GetSafeNormal() * Impulse);
     }
 }
 
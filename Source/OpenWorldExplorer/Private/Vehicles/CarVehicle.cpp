@@ -1,5 +1,5 @@
 #include "Vehicles/CarVehicle.h"
-#include "Components/AudioComponent.h"
+#include "Vehicles/VehicleEngineAudioComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "ChaosWheeledVehicleMovementComponent.h"
@@ -20,14 +20,33 @@ ACarVehicle::ACarVehicle()
     RearBumperMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("RearBumperMesh"));
     RearBumperMesh->SetupAttachment(BodyworkMesh);
     
-    EngineSound = CreateDefaultSubobject<UAudioComponent>(TEXT("EngineSound"));
+    EngineSound = CreateDefaultSubobject<UVehicleEngineAudioComponent>(TEXT("EngineSound"));
     EngineSound->SetupAttachment(BodyworkMesh);
-    EngineSound->bAutoActivate = false;
+    EngineSound->FallbackPitchRange = FVector2D(0.8f, 3.0f);
+    EngineSound->FallbackVolumeRange = FVector2D(0.3f, 1.0f);
     
     // Set default car properties
     HorsePower = 350.0f;
     MaxRPM = 7500.0f;
     TopSpeed = 200.0f; // km/h
+    
+    // Low road tyres dig in and lose grip off tarmac
+    FVehicleSurfaceResponse Offroad;
+    Offroad.ThrottleMultiplier = 0.7f;
+    Offroad.TractionMultiplier = 0.65f;
+    Offroad.RollingResistance = 0.06f;
+    SurfaceResponses.Add(EVehicleSurface::Dirt, Offroad);
+    SurfaceResponses.Add(EVehicleSurface::Grass, Offroad);
+    Offroad.RollingResistance = 0.15f;
+    SurfaceResponses.Add(EVehicleSurface::Sand, Offroad);
+    
+    // Too low to wade far
+    FVehicleSurfaceResponse Water;
+    Water.MaxThrottle = 0.3f;
+    Water.TractionMultiplier = 0.5f;
+    Water.RollingResistance = 0.25f;
+    SurfaceResponses.Add(EVehicleSurface::Water, Water);
+    RebuildSurfaceTables();
 }
 
 void ACarVehicle::BeginPlay()
@@ -35,65 +54,29 @@ void ACarVehicle::BeginPlay()
     Super::BeginPlay();
     
     // Configure chaos vehicle movement based on car properties
-    UChaosWheeledVehicleMovementComponent* CarMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-    if (CarMovement)
+    if (VehicleMovement)
     {
         // Set engine torque based on horsepower
         // 1 HP = ~0.75 kW, and we need to convert to Nm for the engine curve
         const float TorqueMultiplier = HorsePower * 0.75f;
-        CarMovement->EngineSetup.MaxTorque = TorqueMultiplier;
+        VehicleMovement->EngineSetup.MaxTorque = TorqueMultiplier;
         
         // Set max RPM
-        CarMovement->EngineSetup.MaxRPM = MaxRPM;
+        VehicleMovement->EngineSetup.MaxRPM = MaxRPM;
         
         // Configure transmission based on car performance
-        CarMovement->TransmissionSetup.GearAutoBoxLatency = 0.1f;
-        CarMovement->TransmissionSetup.FinalRatio = 3.5f;
+        VehicleMovement->TransmissionSetup.GearAutoBoxLatency = 0.1f;
+        VehicleMovement->TransmissionSetup.FinalRatio = 3.5f;
         
         // Start the engine sound
         if (EngineSound)
         {
+            EngineSound->FallbackMaxRPM = MaxRPM;
             EngineSound->Play();
         }
     }
 }
 
-void ACarVehicle::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-    
-    // Update the engine sound based on current RPM
-    UChaosWheeledVehicleMovementComponent* CarMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-    if (CarMovement && EngineSound)
-    {
-        float CurrentRPM = CarMovement->GetEngineRotationSpeed();
-        UpdateEngineSound(CurrentRPM);
-    }
-}
-
-void ACarVehicle::UpdateEngineSound(float CurrentRPM)
-{
-    if (EngineSound)
-    {
-        // Calculate RPM ratio (0.0 to 1.0)
-        float RPMRatio = FMath::Clamp(CurrentRPM / MaxRPM, 0.0f, 1.0f);
-        
-        // Adjust pitch based on RPM
-        float BasePitch = 0.8f; // Base pitch at idle
-        float MaxPitchMultiplier = 3.0f; // Maximum pitch at redline
-        
-        float CurrentPitch = BasePitch + (MaxPitchMultiplier - BasePitch) * RPMRatio;
-        EngineSound->SetPitchMultiplier(CurrentPitch);
-        
-        // Adjust volume based on RPM
-        float MinVolume = 0.3f; // Volume at idle
-        float MaxVolume = 1.0f; // Volume at high RPM
-        
-        float CurrentVolume = MinVolume + (MaxVolume - MinVolume) * RPMRatio;
-        EngineSound->SetVolumeMultiplier(CurrentVolume);
-    }
-}
-
 void ACarVehicle::SetBodywork(UStaticMesh* NewBodyworkMesh)
 {
     if (BodyworkMesh && NewBodyworkMesh)
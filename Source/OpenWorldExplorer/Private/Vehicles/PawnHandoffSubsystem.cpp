@@ -0,0 +1,205 @@
+#include "Vehicles/PawnHandoffSubsystem.h"
+#include "Vehicles/BaseVehicle.h"
+#include "Characters/ExplorerCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Controller.h"
+#include "Engine/World.h"
+
+// How far above and below an exit spot we look for ground
+static const float ExitSearchHeight = 200.0f;
+
+// Gap left between the vehicle and the character's capsule
+static const float ExitClearance = 20.0f;
+
+void UPawnHandoffSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    CharacterClass = AExplorerCharacter::StaticClass();
+    ExitSweepDelegate.BindUObject(this, &UPawnHandoffSubsystem::OnExitSweepDone);
+    PendingExits.Reserve(2);
+}
+
+void UPawnHandoffSubsystem::RegisterDriver(ABaseVehicle* Vehicle, AExplorerCharacter* Character)
+{
+    if (!Vehicle || !Character)
+        return;
+
+    ReclaimOrphanedDrivers();
+
+    Drivers.Add(Vehicle, Character);
+    IdleCharacters.RemoveSingleSwap(Character);
+    CharacterClass = Character->GetClass();
+}
+
+void UPawnHandoffSubsystem::RequestExit(ABaseVehicle* Vehicle)
+{
+    if (!Vehicle || IsExitPending(Vehicle))
+        return;
+
+    AExplorerCharacter* Character = TakeDriver(Vehicle);
+    if (!Character)
+        return;
+
+    UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+    const float Radius = Capsule->GetScaledCapsuleRadius();
+    const float HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+
+    // Vehicle size in its own space, so spots stay beside it whichever way it faces
+    const FBox LocalBounds = Vehicle->CalculateComponentsBoundingBoxInLocalSpace();
+    const FVector Extent = LocalBounds.IsValid ? LocalBounds.GetExtent() : FVector(200.0f, 100.0f, 80.0f);
+    const FVector Center = Vehicle->GetActorTransform().TransformPosition(LocalBounds.IsValid ? LocalBounds.GetCenter() : FVector::ZeroVector);
+    const float SideOffset = Extent.Y + Radius + ExitClearance;
+    const float EndOffset = Extent.X + Radius + ExitClearance;
+
+    FPendingExit& Exit = PendingExits.AddDefaulted_GetRef();
+    Exit.Vehicle = Vehicle;
+    Exit.Character = Character;
+    Exit.Controller = Vehicle->GetController();
+    Exit.FallbackLocation = Center + FVector(0.0f, 0.0f, Extent.Z + HalfHeight);
+    Exit.Yaw = Vehicle->GetActorRotation().Yaw;
+    Exit.Remaining = NumExitCandidates;
+    Exit.Locations[0] = Center + Vehicle->GetActorRightVector() * SideOffset;
+    Exit.Locations[1] = Center - Vehicle->GetActorRightVector() * SideOffset;
+    Exit.Locations[2] = Center - Vehicle->GetActorForwardVector() * EndOffset;
+    Exit.Locations[3] = Center + Vehicle->GetActorForwardVector() * EndOffset;
+
+    // A capsule swept down from above each spot finds both whether it's free and where the ground is
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(VehicleExit), false);
+    QueryParams.AddIgnoredActor(Vehicle);
+    QueryParams.AddIgnoredActor(Character);
+    const FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(Radius, HalfHeight);
+
+    for (int32 Index = 0; Index < NumExitCandidates; ++Index)
+    {
+        const FVector Start = Exit.Locations[Index] + FVector(0.0f, 0.0f, ExitSearchHeight);
+        const FVector End = Exit.Locations[Index] - FVector(0.0f, 0.0f, ExitSearchHeight);
+
+        Exit.bValid[Index] = false;
+        Exit.Handles[Index] = GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, FQuat::Identity, ECC_Pawn, CapsuleShape, QueryParams, FCollisionResponseParams::DefaultResponseParam, &ExitSweepDelegate);
+    }
+}
+
+bool UPawnHandoffSubsystem::IsExitPending(const ABaseVehicle* Vehicle) const
+{
+    for (const FPendingExit& Exit : PendingExits)
+    {
+        if (Exit.Vehicle.Get() == Vehicle)
+            return true;
+    }
+
+    return false;
+}
+
+AExplorerCharacter* UPawnHandoffSubsystem::TakeDriver(ABaseVehicle* Vehicle)
+{
+    ReclaimOrphanedDrivers();
+
+    TWeakObjectPtr<AExplorerCharacter> Driver;
+    if (Drivers.RemoveAndCopyValue(Vehicle, Driver) && Driver.IsValid())
+    {
+        return Driver.Get();
+    }
+
+    // Vehicles the player started in have no driver yet
+    AExplorerCharacter* Character = IdleCharacters.Num() > 0 ? IdleCharacters.Pop(false) : nullptr;
+    if (!Character)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        Character = GetWorld()->SpawnActor<AExplorerCharacter>(CharacterClass, Vehicle->GetActorTransform(), SpawnParams);
+    }
+
+    if (Character)
+    {
+        Character->ParkInVehicle(Vehicle);
+    }
+
+    return Character;
+}
+
+void UPawnHandoffSubsystem::ReclaimOrphanedDrivers()
+{
+    for (auto It = Drivers.CreateIterator(); It; ++It)
+    {
+        if (It.Key().IsValid())
+            continue;
+
+        if (AExplorerCharacter* Character = It.Value().Get())
+        {
+            IdleCharacters.AddUnique(Character);
+        }
+        It.RemoveCurrent();
+    }
+}
+
+void UPawnHandoffSubsystem::OnExitSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceData)
+{
+    for (int32 ExitIndex = 0; ExitIndex < PendingExits.Num(); ++ExitIndex)
+    {
+        FPendingExit& Exit = PendingExits[ExitIndex];
+
+        int32 Index = 0;
+        while (Index < NumExitCandidates && !(Exit.Handles[Index] == TraceHandle))
+        {
+            ++Index;
+        }
+
+        if (Index < NumExitCandidates)
+        {
+            // Free if the capsule reached ground without starting inside something
+            const FHitResult* Hit = TraceData.OutHits.Num() > 0 ? &TraceData.OutHits[0] : nullptr;
+            if (Hit && Hit->bBlockingHit && !Hit->bStartPenetrating)
+            {
+                Exit.Locations[Index] = Hit->Location;
+                Exit.bValid[Index] = true;
+            }
+
+            if (--Exit.Remaining == 0)
+            {
+                const FPendingExit Finished = Exit;
+                PendingExits.RemoveAtSwap(ExitIndex, 1, false);
+                CompleteExit(Finished);
+            }
+            return;
+        }
+    }
+}
+
+void UPawnHandoffSubsystem::CompleteExit(const FPendingExit& Exit)
+{
+    ABaseVehicle* Vehicle = Exit.Vehicle.Get();
+    AExplorerCharacter* Character = Exit.Character.Get();
+    if (!Character)
+        return;
+
+    // Nowhere free around it, climb out on top, or where it stood if it has been destroyed meanwhile
+    FVector ExitLocation = Exit.FallbackLocation;
+    if (Vehicle)
+    {
+        ExitLocation = Vehicle->GetActorLocation() + FVector(0.0f, 0.0f, Vehicle->GetSimpleCollisionHalfHeight() + Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
+    }
+
+    for (int32 Index = 0; Index < NumExitCandidates; ++Index)
+    {
+        if (Exit.bValid[Index])
+        {
+            ExitLocation = Exit.Locations[Index];
+            break;
+        }
+    }
+
+    Character->LeaveVehicle(ExitLocation, FRotator(0.0f, Vehicle ? Vehicle->GetActorRotation().Yaw : Exit.Yaw, 0.0f));
+
+    AController* VehicleController = Vehicle ? Vehicle->GetController() : nullptr;
+    if (!VehicleController)
+    {
+        VehicleController = Exit.Controller.Get();
+    }
+
+    if (VehicleController)
+    {
+        VehicleController->UnPossess();
+        VehicleController->Possess(Character);
+    }
+}
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "Vehicles/SUVVehicle.h"
-#include "Components/AudioComponent.h"
+#include "Vehicles/VehicleEngineAudioComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SpotLightComponent.h"
 #include "ChaosWheeledVehicleMovementComponent.h"
@@ -15,9 +15,11 @@ ASUVVehicle::ASUVVehicle()
     BullBarMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("BullBarMesh"));
     BullBarMesh->SetupAttachment(VehicleMesh);
     
-    EngineSound = CreateDefaultSubobject<UAudioComponent>(TEXT("EngineSound"));
+    EngineSound = CreateDefaultSubobject<UVehicleEngineAudioComponent>(TEXT("EngineSound"));
     EngineSound->SetupAttachment(VehicleMesh);
-    EngineSound->bAutoActivate = false;
+    EngineSound->FallbackMaxRPM = 7000.0f;
+    EngineSound->FallbackPitchRange = FVector2D(0.8f, 2.5f);
+    EngineSound->FallbackVolumeRange = FVector2D(0.4f, 1.0f);
     
     // Create spotlight components
     LeftSpotlight = CreateDefaultSubobject<USpotLightComponent>(TEXT("LeftSpotlight"));
@@ -42,34 +44,43 @@ ASUVVehicle::ASUVVehicle()
     RoofSpotlight->OuterConeAngle = 60.0f;
     
     // Set default SUV properties
-    OffroadTractionMultiplier = 1.5f;
     WaterDepthTolerance = 75.0f; // cm
     MaxTorque = 2500.0f;
     
     // Initialize state variables
     bOffroadModeEnabled = false;
     bSpotlightsEnabled = false;
-    CurrentTerrainType = NAME_None;
+    
+    // Off-road surfaces - more power, grip and more controlled steering in off-road mode
+    FVehicleSurfaceResponse Offroad;
+    Offroad.ThrottleMultiplier = 1.5f;
+    Offroad.SteeringMultiplier = 0.85f;
+    Offroad.RollingResistance = 0.03f;
+    OffroadSurfaceResponses.Add(EVehicleSurface::Dirt, Offroad);
+    OffroadSurfaceResponses.Add(EVehicleSurface::Grass, Offroad);
+    Offroad.RollingResistance = 0.06f;
+    OffroadSurfaceResponses.Add(EVehicleSurface::Sand, Offroad);
 }
 
 void ASUVVehicle::BeginPlay()
 {
     Super::BeginPlay();
     
+    RebuildSurfaceTables(bOffroadModeEnabled ? &OffroadSurfaceResponses : nullptr);
+    
     // Configure chaos vehicle movement for SUV
-    UChaosWheeledVehicleMovementComponent* SUVMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-    if (SUVMovement)
+    if (VehicleMovement)
     {
         // Set engine torque for SUV
-        SUVMovement->EngineSetup.MaxTorque = MaxTorque;
+        VehicleMovement->EngineSetup.MaxTorque = MaxTorque;
         
         // Configure wheel setup for off-road
-        for (int32 WheelIdx = 0; WheelIdx < SUVMovement->WheelSetups.Num(); WheelIdx++)
+        for (int32 WheelIdx = 0; WheelIdx < VehicleMovement->WheelSetups.Num(); WheelIdx++)
         {
             // Increase suspension to handle rough terrain
-            SUVMovement->WheelSetups[WheelIdx].SuspensionMaxRaise = 15.0f;
-            SUVMovement->WheelSetups[WheelIdx].SuspensionMaxDrop = 15.0f;
-            SUVMovement->WheelSetups[WheelIdx].SuspensionDampingRatio = 0.7f;
+            VehicleMovement->WheelSetups[WheelIdx].SuspensionMaxRaise = 15.0f;
+            VehicleMovement->WheelSetups[WheelIdx].SuspensionMaxDrop = 15.0f;
+            VehicleMovement->WheelSetups[WheelIdx].SuspensionDampingRatio = 0.7f;
         }
         
         // Start the engine sound
@@ -80,29 +91,6 @@ void ASUVVehicle::BeginPlay()
     }
 }
 
-void ASUVVehicle::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-    
-    // Update terrain detection for vehicle handling
-    UpdateTerrainDetection();
-    
-    // Update engine sound based on RPM
-    UChaosWheeledVehicleMovementComponent* SUVMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-    if (SUVMovement && EngineSound)
-    {
-        float CurrentRPM = SUVMovement->GetEngineRotationSpeed();
-        float RPMRatio = FMath::Clamp(CurrentRPM / 7000.0f, 0.0f, 1.0f);
-        
-        // Adjust pitch and volume based on RPM
-        float CurrentPitch = 0.8f + (2.5f - 0.8f) * RPMRatio;
-        float CurrentVolume = 0.4f + (1.0f - 0.4f) * RPMRatio;
-        
-        EngineSound->SetPitchMultiplier(CurrentPitch);
-        EngineSound->SetVolumeMultiplier(CurrentVolume);
-    }
-}
-
 void ASUVVehicle::ToggleSpotlights(bool bEnabled)
 {
     bSpotlightsEnabled = bEnabled;
@@ -122,9 +110,9 @@ void ASUVVehicle::ToggleSpotlights(bool bEnabled)
 void ASUVVehicle::ToggleOffroadMode(bool bEnabled)
 {
     bOffroadModeEnabled = bEnabled;
+    RebuildSurfaceTables(bEnabled ? &OffroadSurfaceResponses : nullptr);
     
-    UChaosWheeledVehicleMovementComponent* SUVMovement = Cast<UChaosWheeledVehicleMovementComponent>(VehicleMovement);
-    if (SUVMovement)
+    if (VehicleMovement)
     {
         // Adjust tire friction and suspension based on mode
         float TireFriction = bEnabled ? 3.0f : 2.0f;
@@ -132,14 +120,14 @@ void ASUVVehicle::ToggleOffroadMode(bool bEnabled)
         float SuspensionMaxRaise = bEnabled ? 15.0f : 10.0f;
         float SuspensionMaxDrop = bEnabled ? 15.0f : 10.0f;
         
-        for (int32 WheelIdx = 0; WheelIdx < SUVMovement->WheelSetups.Num(); WheelIdx++)
+        for (int32 WheelIdx = 0; WheelIdx < VehicleMovement->WheelSetups.Num(); WheelIdx++)
         {
-            SUVMovement->WheelSetups[WheelIdx].TireConfig->TireFriction = TireFriction;
+            VehicleMovement->WheelSetups[WheelIdx].TireConfig->TireFriction = TireFriction;
         }
         
-        SUVMovement->SuspensionForceOffset = SuspensionForce;
-        SUVMovement->SuspensionMaxRaise = SuspensionMaxRaise;
-        SUVMovement->SuspensionMaxDrop = SuspensionMaxDrop;
+        VehicleMovement->SuspensionForceOffset = SuspensionForce;
+        VehicleMovement->SuspensionMaxRaise = SuspensionMaxRaise;
+        VehicleMovement->SuspensionMaxDrop = SuspensionMaxDrop;
     }
     
     // Play mode change sound effect
@@ -176,89 +164,4 @@ void ASUVVehicle::SetBullBar(UStaticMesh* NewBullBarMesh)
             BullBarMesh->SetVisibility(false);
         }
     }
-}
-
-void ASUVVehicle::ApplyThrottle(float Value)
-{
-    // Modify throttle response based on terrain and offroad mode
-    float ModifiedThrottle = Value;
-    
-    if (CurrentTerrainType == TEXT("Dirt") || 
-        CurrentTerrainType == TEXT("Grass") || 
-        CurrentTerrainType == TEXT("Sand"))
-    {
-        // Off-road surfaces
-        ModifiedThrottle = Value * (bOffroadModeEnabled ? OffroadTractionMultiplier : 0.8f);
-    }
-    else if (CurrentTerrainType == TEXT("Snow") || 
-             CurrentTerrainType == TEXT("Ice"))
-    {
-        // Slippery surfaces - reduce throttle to prevent wheel spin
-        ModifiedThrottle = Value * 0.6f;
-    }
-    else if (CurrentTerrainType == TEXT("Water"))
-    {
-        // Water crossing - maintain momentum but don't allow too much power
-        ModifiedThrottle = FMath::Clamp(Value, -0.5f, 0.5f);
-    }
-    
-    // Apply modified throttle
-    Super::ApplyThrottle(ModifiedThrottle);
-}
-
-void ASUVVehicle::ApplySteering(float Value)
-{
-    // Modify steering response based on terrain and offroad mode
-    float ModifiedSteering = Value;
-    
-    if (CurrentTerrainType == TEXT("Dirt") || 
-        CurrentTerrainType == TEXT("Grass") || 
-        CurrentTerrainType == TEXT("Sand"))
-    {
-        // Off-road surfaces - more controlled steering in off-road mode
-        if (bOffroadModeEnabled)
-        {
-            ModifiedSteering = Value * 0.85f;
-        }
-    }
-    else if (CurrentTerrainType == TEXT("Snow") || 
-             CurrentTerrainType == TEXT("Ice"))
-    {
-        // Slippery surfaces - reduce steering sensitivity
-        ModifiedSteering = Value * 0.7f;
-    }
-    
-    // Apply modified steering
-    Super::ApplySteering(ModifiedSteering);
-}
-
-void ASUVVehicle::UpdateTerrainDetection()
-{
-    // Use line trace to detect terrain type below the vehicle
-    FHitResult HitResult;
-    FVector Start = GetActorLocation();
-    FVector End = Start - FVector(0, 0, 200);
-    
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(this);
-    
-    if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams))
-    {
-        // Check the physical material to determine surface type
-        UPhysicalMaterial* PhysMat = HitResult.PhysMaterial.Get();
-        if (PhysMat)
-        {
-            // In a full implementation, we'd check the physical material
-            // properties to determine the surface type
-            AActor* HitActor = HitResult.GetActor();
-            if (HitActor && HitActor->Tags.Num() > 0)
-            {
-                CurrentTerrainType = HitActor->Tags[0];
-            }
-            else
-            {
-                CurrentTerrainType = TEXT("Road"); // Default to road
-            }
-        }
-    }
 }
\ No newline at end of file
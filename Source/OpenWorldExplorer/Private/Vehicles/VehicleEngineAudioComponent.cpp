@@ -0,0 +1,166 @@
+#include "Vehicles/VehicleEngineAudioComponent.h"
+#include "Vehicles/EngineSoundProfile.h"
+#include "ChaosWheeledVehicleMovementComponent.h"
+#include "Curves/CurveFloat.h"
+#include "GameFramework/Pawn.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "OpenWorldExplorer.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Engine Audio Parameter Updates"), STAT_EngineAudioUpdates, STATGROUP_OpenWorldExplorer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Virtualized Engine Sounds"), STAT_VirtualizedEngineSounds, STATGROUP_OpenWorldExplorer);
+
+UVehicleEngineAudioComponent::UVehicleEngineAudioComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = true;
+    bAutoActivate = false;
+
+    SoundProfile = nullptr;
+    FallbackMaxRPM = 7000.0f;
+    FallbackPitchRange = FVector2D(0.8f, 2.5f);
+    FallbackVolumeRange = FVector2D(0.4f, 1.0f);
+    PitchThreshold = 0.006f;
+    VolumeThreshold = 0.02f;
+    LayerBlendThreshold = 0.02f;
+    FullRateDistance = 3000.0f; // 30m
+    VirtualizeDistance = 15000.0f; // 150m
+    LowRateInterval = 0.2f;
+    VirtualizedInterval = 0.5f;
+
+    SentPitch = -1.0f;
+    SentVolume = -1.0f;
+    SentLayerBlend = -1.0f;
+    bVirtualized = false;
+}
+
+void UVehicleEngineAudioComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    VehicleMovement = GetOwner() ? GetOwner()->FindComponentByClass<UChaosWheeledVehicleMovementComponent>() : nullptr;
+}
+
+void UVehicleEngineAudioComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (bVirtualized)
+    {
+        bVirtualized = false;
+        DEC_DWORD_STAT(STAT_VirtualizedEngineSounds);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UVehicleEngineAudioComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (UpdateAudioLOD())
+    {
+        UpdateEngineParameters();
+    }
+}
+
+void UVehicleEngineAudioComponent::SetDormant(bool bDormant)
+{
+    if (bDormant && !bVirtualized && IsPlaying())
+    {
+        Stop();
+        bVirtualized = true;
+        INC_DWORD_STAT(STAT_VirtualizedEngineSounds);
+    }
+    
+    SetComponentTickEnabled(!bDormant);
+}
+
+bool UVehicleEngineAudioComponent::UpdateAudioLOD()
+{
+    APawn* OwnerPawn = Cast<APawn>(GetOwner());
+    const bool bPossessed = OwnerPawn && OwnerPawn->IsPlayerControlled();
+
+    float DistanceSquared = 0.0f;
+    if (!bPossessed)
+    {
+        APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+        DistanceSquared = CameraManager ? FVector::DistSquared(CameraManager->GetCameraLocation(), GetComponentLocation()) : 0.0f;
+    }
+
+    // Out of earshot, stop the sound but remember to bring it back
+    if (DistanceSquared > FMath::Square(VirtualizeDistance))
+    {
+        if (!bVirtualized && IsPlaying())
+        {
+            Stop();
+            bVirtualized = true;
+            INC_DWORD_STAT(STAT_VirtualizedEngineSounds);
+        }
+
+        SetComponentTickInterval(VirtualizedInterval);
+        return false;
+    }
+
+    if (bVirtualized)
+    {
+        bVirtualized = false;
+        DEC_DWORD_STAT(STAT_VirtualizedEngineSounds);
+
+        // The restarted sound has default parameters, send everything again
+        SentPitch = -1.0f;
+        SentVolume = -1.0f;
+        SentLayerBlend = -1.0f;
+        Play();
+    }
+
+    SetComponentTickInterval(bPossessed || DistanceSquared < FMath::Square(FullRateDistance) ? 0.0f : LowRateInterval);
+    return IsPlaying();
+}
+
+void UVehicleEngineAudioComponent::UpdateEngineParameters()
+{
+    UChaosWheeledVehicleMovementComponent* Movement = VehicleMovement.Get();
+    if (!Movement)
+        return;
+
+    const float RPM = Movement->GetEngineRotationSpeed();
+    const float Pitch = EvaluateCurve(SoundProfile ? SoundProfile->PitchCurve : nullptr, RPM, FallbackPitchRange);
+    const float Volume = EvaluateCurve(SoundProfile ? SoundProfile->VolumeCurve : nullptr, RPM, FallbackVolumeRange);
+
+    // Pitch is heard as a ratio, so compare relative to the last value sent
+    if (SentPitch < 0.0f || FMath::Abs(Pitch - SentPitch) > PitchThreshold * SentPitch)
+    {
+        SetPitchMultiplier(Pitch);
+        SentPitch = Pitch;
+        INC_DWORD_STAT(STAT_EngineAudioUpdates);
+    }
+
+    if (SentVolume < 0.0f || FMath::Abs(Volume - SentVolume) > VolumeThreshold)
+    {
+        SetVolumeMultiplier(Volume);
+        SentVolume = Volume;
+        INC_DWORD_STAT(STAT_EngineAudioUpdates);
+    }
+
+    // Layers only exist on sounds that have a blend curve
+    if (SoundProfile && SoundProfile->LayerBlendCurve)
+    {
+        const float LayerBlend = FMath::Clamp(SoundProfile->LayerBlendCurve->GetFloatValue(RPM), 0.0f, 1.0f);
+        if (SentLayerBlend < 0.0f || FMath::Abs(LayerBlend - SentLayerBlend) > LayerBlendThreshold)
+        {
+            SetFloatParameter(SoundProfile->LayerBlendParameter, LayerBlend);
+            SentLayerBlend = LayerBlend;
+            INC_DWORD_STAT(STAT_EngineAudioUpdates);
+        }
+    }
+}
+
+float UVehicleEngineAudioComponent::EvaluateCurve(const UCurveFloat* Curve, float RPM, const FVector2D& FallbackRange) const
+{
+    if (Curve)
+    {
+        return Curve->GetFloatValue(RPM);
+    }
+
+    const float RPMRatio = FMath::Clamp(RPM / FallbackMaxRPM, 0.0f, 1.0f);
+    return FMath::Lerp(FallbackRange.X, FallbackRange.Y, RPMRatio);
+}
\ No newline at end of file
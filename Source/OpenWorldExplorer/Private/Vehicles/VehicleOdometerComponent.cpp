@@ -0,0 +1,97 @@
+#include "Vehicles/VehicleOdometerComponent.h"
+#include "GameFramework/Pawn.h"
+#include "World/ProgressionSystem.h"
+#include "Kismet/GameplayStatics.h"
+
+UVehicleOdometerComponent::UVehicleOdometerComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+
+    // Default values
+    FlushInterval = 5.0f;
+    FlushDistance = 50.0f;
+    MinStepDistance = 0.01f;
+    LastLocation = FVector::ZeroVector;
+    OdometerMeters = 0.0;
+    PendingMeters = 0.0;
+    TimeSinceFlush = 0.0f;
+}
+
+void UVehicleOdometerComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (GetOwner())
+    {
+        LastLocation = GetOwner()->GetActorLocation();
+    }
+}
+
+void UVehicleOdometerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Don't lose the last partial batch
+    FlushToProgression();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UVehicleOdometerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    AActor* Owner = GetOwner();
+    if (!Owner)
+        return;
+
+    const FVector CurrentLocation = Owner->GetActorLocation();
+    const double StepMeters = FVector::Dist(CurrentLocation, LastLocation) / 100.0; // Convert to meters
+
+    if (StepMeters > MinStepDistance)
+    {
+        OdometerMeters += StepMeters;
+
+        // Only distance driven by a player counts towards progression
+        APawn* OwnerPawn = Cast<APawn>(Owner);
+        if (OwnerPawn && OwnerPawn->IsPlayerControlled())
+        {
+            PendingMeters += StepMeters;
+        }
+
+        LastLocation = CurrentLocation;
+    }
+
+    TimeSinceFlush += DeltaTime;
+    if (PendingMeters >= FlushDistance || (PendingMeters > 0.0 && TimeSinceFlush >= FlushInterval))
+    {
+        FlushToProgression();
+    }
+}
+
+void UVehicleOdometerComponent::FlushToProgression()
+{
+    TimeSinceFlush = 0.0f;
+
+    if (PendingMeters <= 0.0)
+        return;
+
+    UProgressionSystem* ProgressionSystem = GetProgressionSystem();
+    if (ProgressionSystem)
+    {
+        ProgressionSystem->RegisterDistanceTraveled((float)PendingMeters, true);
+        PendingMeters = 0.0;
+    }
+}
+
+UProgressionSystem* UVehicleOdometerComponent::GetProgressionSystem()
+{
+    if (!CachedProgressionSystem.IsValid())
+    {
+        UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
+        if (GameInstance)
+        {
+            CachedProgressionSystem = Cast<UProgressionSystem>(GameInstance->GetSubsystem<UProgressionSystem>());
+        }
+    }
+
+    return CachedProgressionSystem.Get();
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#include "Vehicles/VehicleRegistrySubsystem.h"
+#include "Vehicles/BaseVehicle.h"
+
+void UVehicleRegistrySubsystem::RegisterVehicle(ABaseVehicle* Vehicle)
+{
+    if (Vehicle)
+    {
+        Vehicles.AddUnique(Vehicle);
+    }
+}
+
+void UVehicleRegistrySubsystem::UnregisterVehicle(ABaseVehicle* Vehicle)
+{
+    Vehicles.RemoveSingleSwap(Vehicle);
+}
\ No newline at end of file
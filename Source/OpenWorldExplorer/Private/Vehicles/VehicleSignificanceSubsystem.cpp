@@ -0,0 +1,126 @@
+#include "Vehicles/VehicleSignificanceSubsystem.h"
+#include "Vehicles/BaseVehicle.h"
+#include "Vehicles/VehicleRegistrySubsystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "OpenWorldExplorer.h"
+
+static TAutoConsoleVariable<int32> CVarVehicleSignificanceBudget(
+    TEXT("ow.Vehicle.SignificanceBudget"),
+    32,
+    TEXT("Vehicles scored for significance per frame. The rest wait for their turn in the round robin."),
+    ECVF_Scalability);
+
+// Unpossessed vehicles slower than this (cm/s) with their wheels down are parked
+static const float RestSpeed = 20.0f;
+
+// Projected bounds radius as a fraction of half the screen height
+static const float HighScreenSize = 0.1f;
+static const float MediumScreenSize = 0.03f;
+
+// Vehicles not rendered for this long are scored as Low whatever their size
+static const float RenderedGraceSeconds = 0.5f;
+
+DECLARE_CYCLE_STAT(TEXT("Vehicle Significance"), STAT_VehicleSignificance, STATGROUP_OpenWorldExplorer);
+
+void UVehicleSignificanceSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_VehicleSignificance);
+    
+    // Tier changes would overwrite tick and physics state the freeze has taken over
+    if (bScoringPaused)
+        return;
+    
+    UVehicleRegistrySubsystem* VehicleRegistry = GetWorld()->GetSubsystem<UVehicleRegistrySubsystem>();
+    APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+    if (!VehicleRegistry || !CameraManager)
+        return;
+    
+    const TArray<ABaseVehicle*>& Vehicles = VehicleRegistry->GetVehicles();
+    if (Vehicles.Num() == 0)
+        return;
+    
+    const FVector ViewLocation = CameraManager->GetCameraLocation();
+    const float ScreenScale = 1.0f / FMath::Tan(FMath::DegreesToRadians(FMath::Max(CameraManager->GetFOVAngle(), 1.0f) * 0.5f));
+    
+    const int32 NumToScore = FMath::Min(Vehicles.Num(), FMath::Max(CVarVehicleSignificanceBudget.GetValueOnGameThread(), 1));
+    for (int32 Count = 0; Count < NumToScore; Count++)
+    {
+        if (NextVehicle >= Vehicles.Num())
+        {
+            NextVehicle = 0;
+        }
+        
+        ABaseVehicle* Vehicle = Vehicles[NextVehicle++];
+        if (Vehicle)
+        {
+            Vehicle->SetSignificance(EvaluateSignificance(Vehicle, ViewLocation, ScreenScale));
+        }
+    }
+}
+
+bool UVehicleSignificanceSubsystem::IsTickable() const
+{
+    return !IsTemplate() && GetWorld() && GetWorld()->IsGameWorld();
+}
+
+TStatId UVehicleSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UVehicleSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+const FVehicleSignificanceTier& UVehicleSignificanceSubsystem::GetTierSettings(EVehicleSignificance Significance)
+{
+    // Tick interval, mesh tick interval, when the mesh animates
+    static const FVehicleSignificanceTier Tiers[] =
+    {
+        { 0.0f, 0.0f, EVisibilityBasedAnimTickOption::AlwaysTickPose },
+        { 0.0f, 0.0f, EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered },
+        { 0.05f, 1.0f / 30.0f, EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered },
+        { 0.25f, 0.2f, EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered },
+        { 0.0f, 0.0f, EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered },
+    };
+    
+    return Tiers[FMath::Min((int32)Significance, (int32)UE_ARRAY_COUNT(Tiers) - 1)];
+}
+
+void UVehicleSignificanceSubsystem::RefreshVehicle(ABaseVehicle* Vehicle)
+{
+    APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+    if (!Vehicle || !CameraManager || bScoringPaused)
+        return;
+    
+    const float ScreenScale = 1.0f / FMath::Tan(FMath::DegreesToRadians(FMath::Max(CameraManager->GetFOVAngle(), 1.0f) * 0.5f));
+    Vehicle->SetSignificance(EvaluateSignificance(Vehicle, CameraManager->GetCameraLocation(), ScreenScale));
+}
+
+EVehicleSignificance UVehicleSignificanceSubsystem::EvaluateSignificance(const ABaseVehicle* Vehicle, const FVector& ViewLocation, float ScreenScale) const
+{
+    if (Vehicle->IsPlayerControlled())
+    {
+        return EVehicleSignificance::Player;
+    }
+    
+    if (Vehicle->IsAtRest(RestSpeed))
+    {
+        return EVehicleSignificance::Dormant;
+    }
+    
+    // Moving but off screen, keep it simulating at the lowest rate
+    if (!Vehicle->WasRecentlyRendered(RenderedGraceSeconds))
+    {
+        return EVehicleSignificance::Low;
+    }
+    
+    const USceneComponent* Root = Vehicle->GetRootComponent();
+    const float Distance = FMath::Max(FVector::Dist(ViewLocation, Vehicle->GetActorLocation()), 1.0f);
+    const float ScreenSize = Root->Bounds.SphereRadius * ScreenScale / Distance;
+    
+    if (ScreenSize >= HighScreenSize)
+    {
+        return EVehicleSignificance::High;
+    }
+    
+    return ScreenSize >= MediumScreenSize ? EVehicleSignificance::Medium : EVehicleSignificance::Low;
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Characters/ExplorerCharacter.h"
 #include "Vehicles/BaseVehicle.h"
 #include "World/PhotographySystem.h"
+#include "World/ProgressionSystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerStart.h"
 
@@ -58,6 +59,19 @@ void AOpenWorldGameMode::BeginPlay()
     SpawnStartingVehicles();
 }
 
+void AOpenWorldGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Write out any progression changes still waiting for the save debounce window
+    UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
+    UProgressionSystem* ProgressionSystem = GameInstance ? Cast<UProgressionSystem>(GameInstance->GetSubsystem<UProgressionSystem>()) : nullptr;
+    if (ProgressionSystem)
+    {
+        ProgressionSystem->FlushPendingSave();
+    }
+    
+    Super::EndPlay(EndPlayReason);
+}
+
 void AOpenWorldGameMode::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
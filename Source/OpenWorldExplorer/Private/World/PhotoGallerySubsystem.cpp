@@ -0,0 +1,281 @@
+#include "World/PhotoGallerySubsystem.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "ImageUtils.h"
+#include "Async/Async.h"
+
+// Catalog file layout: magic, version, then size-prefixed records
+static const uint32 GalleryCatalogMagic = 0x4F574731; // "OWG1"
+static const int32 GalleryCatalogVersion = 1;
+
+static void SerializePhotoRecord(FArchive& Ar, FPhotoMetadata& Metadata)
+{
+    uint8 Filter = static_cast<uint8>(Metadata.AppliedFilter);
+
+    Ar << Metadata.FilePath;
+    Ar << Metadata.Location;
+    Ar << Metadata.Timestamp;
+    Ar << Metadata.WeatherCondition;
+    Ar << Metadata.TimeOfDay;
+    Ar << Filter;
+    Ar << Metadata.LocationName;
+    Ar << Metadata.CapturedVehicles;
+
+    Metadata.AppliedFilter = static_cast<EPhotoFilter>(Filter);
+}
+
+static TArray<int32> FindInIndex(const TMap<FName, TArray<int32>>& Index, const FString& Key)
+{
+    const FName KeyName(*Key, FNAME_Find);
+    const TArray<int32>* PhotoIndices = KeyName.IsNone() ? nullptr : Index.Find(KeyName);
+    return PhotoIndices ? *PhotoIndices : TArray<int32>();
+}
+
+UPhotoGallerySubsystem::UPhotoGallerySubsystem()
+{
+    MaxCachedThumbnails = 128;
+}
+
+void UPhotoGallerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    CatalogPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("Screenshots") / TEXT("Gallery.bin"));
+    LoadCatalog();
+}
+
+void UPhotoGallerySubsystem::Deinitialize()
+{
+    // Don't lose records still being appended
+    if (LastCatalogWrite.IsValid())
+    {
+        FTaskGraphInterface::Get().WaitUntilTaskCompletes(LastCatalogWrite);
+        LastCatalogWrite = nullptr;
+    }
+
+    Super::Deinitialize();
+}
+
+FString UPhotoGallerySubsystem::GetThumbnailPath(const FString& PhotoPath)
+{
+    return FPaths::GetPath(PhotoPath) / FPaths::GetBaseFilename(PhotoPath) + TEXT("_thumb.jpg");
+}
+
+void UPhotoGallerySubsystem::LoadCatalog()
+{
+    TArray<uint8> CatalogData;
+    if (!FFileHelper::LoadFileToArray(CatalogData, *CatalogPath, FILEREAD_Silent))
+        return;
+
+    FMemoryReader Reader(CatalogData);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Reader << Magic;
+    Reader << Version;
+    if (Reader.IsError() || Magic != GalleryCatalogMagic || Version > GalleryCatalogVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Ignoring unreadable photo catalog: %s"), *CatalogPath);
+        return;
+    }
+
+    while (Reader.Tell() + (int64)sizeof(int32) <= Reader.TotalSize())
+    {
+        int32 RecordSize = 0;
+        Reader << RecordSize;
+
+        // A record cut short by a crash mid-append ends the catalog
+        if (RecordSize <= 0 || Reader.Tell() + RecordSize > Reader.TotalSize())
+            break;
+
+        const int64 RecordEnd = Reader.Tell() + RecordSize;
+
+        FPhotoMetadata Metadata;
+        SerializePhotoRecord(Reader, Metadata);
+        if (Reader.IsError())
+            break;
+
+        // Later versions may append fields, skip anything we don't know
+        Reader.Seek(RecordEnd);
+
+        IndexPhoto(Photos.Add(MoveTemp(Metadata)));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Photo gallery loaded %d photos"), Photos.Num());
+}
+
+void UPhotoGallerySubsystem::AddPhoto(const FPhotoMetadata& Metadata)
+{
+    const int32 PhotoIndex = Photos.Add(Metadata);
+    IndexPhoto(PhotoIndex);
+
+    // Encode the record here, the worker only appends bytes
+    TArray<uint8> Record;
+    FMemoryWriter Writer(Record);
+    int32 RecordSize = 0;
+    Writer << RecordSize;
+    SerializePhotoRecord(Writer, Photos[PhotoIndex]);
+    RecordSize = Record.Num() - sizeof(int32);
+    Writer.Seek(0);
+    Writer << RecordSize;
+
+    FGraphEventArray Prerequisites;
+    if (LastCatalogWrite.IsValid())
+    {
+        Prerequisites.Add(LastCatalogWrite);
+    }
+
+    const FString Path = CatalogPath;
+    LastCatalogWrite = FFunctionGraphTask::CreateAndDispatchWhenReady([Path, Record = MoveTemp(Record)]()
+    {
+        IFileManager& FileManager = IFileManager::Get();
+        const bool bNewCatalog = FileManager.FileSize(*Path) <= 0;
+
+        TUniquePtr<FArchive> File(FileManager.CreateFileWriter(*Path, bNewCatalog ? 0 : FILEWRITE_Append));
+        if (!File)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to open photo catalog: %s"), *Path);
+            return;
+        }
+
+        if (bNewCatalog)
+        {
+            uint32 Magic = GalleryCatalogMagic;
+            int32 Version = GalleryCatalogVersion;
+            *File << Magic;
+            *File << Version;
+        }
+
+        File->Serialize(const_cast<uint8*>(Record.GetData()), Record.Num());
+        File->Close();
+    }, TStatId(), &Prerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void UPhotoGallerySubsystem::IndexPhoto(int32 PhotoIndex)
+{
+    const FPhotoMetadata& Metadata = Photos[PhotoIndex];
+
+    if (!Metadata.LocationName.IsEmpty())
+    {
+        PhotosByLocation.FindOrAdd(FName(*Metadata.LocationName)).Add(PhotoIndex);
+    }
+
+    if (!Metadata.WeatherCondition.IsEmpty())
+    {
+        PhotosByWeather.FindOrAdd(FName(*Metadata.WeatherCondition)).Add(PhotoIndex);
+    }
+
+    for (const FString& VehicleName : Metadata.CapturedVehicles)
+    {
+        TArray<int32>& VehiclePhotos = PhotosByVehicle.FindOrAdd(FName(*VehicleName));
+
+        // The same vehicle can't be listed twice, but guard against old records
+        if (VehiclePhotos.Num() == 0 || VehiclePhotos.Last() != PhotoIndex)
+        {
+            VehiclePhotos.Add(PhotoIndex);
+        }
+    }
+
+    PhotosByFilter.FindOrAdd(Metadata.AppliedFilter).Add(PhotoIndex);
+}
+
+bool UPhotoGallerySubsystem::GetPhoto(int32 PhotoIndex, FPhotoMetadata& OutMetadata) const
+{
+    if (!Photos.IsValidIndex(PhotoIndex))
+        return false;
+
+    OutMetadata = Photos[PhotoIndex];
+    return true;
+}
+
+TArray<int32> UPhotoGallerySubsystem::FindPhotosByLocation(const FString& LocationName) const
+{
+    return FindInIndex(PhotosByLocation, LocationName);
+}
+
+TArray<int32> UPhotoGallerySubsystem::FindPhotosByWeather(const FString& WeatherCondition) const
+{
+    return FindInIndex(PhotosByWeather, WeatherCondition);
+}
+
+TArray<int32> UPhotoGallerySubsystem::FindPhotosByVehicle(const FString& VehicleName) const
+{
+    return FindInIndex(PhotosByVehicle, VehicleName);
+}
+
+TArray<int32> UPhotoGallerySubsystem::FindPhotosByFilter(EPhotoFilter Filter) const
+{
+    const TArray<int32>* PhotoIndices = PhotosByFilter.Find(Filter);
+    return PhotoIndices ? *PhotoIndices : TArray<int32>();
+}
+
+UTexture2D* UPhotoGallerySubsystem::GetThumbnail(int32 PhotoIndex)
+{
+    if (!Photos.IsValidIndex(PhotoIndex))
+        return nullptr;
+
+    if (UTexture2D** CachedThumbnail = ThumbnailCache.Find(PhotoIndex))
+    {
+        TouchThumbnail(PhotoIndex);
+        return *CachedThumbnail;
+    }
+
+    if (PendingThumbnailLoads.Contains(PhotoIndex))
+        return nullptr;
+
+    PendingThumbnailLoads.Add(PhotoIndex);
+
+    // Read the file off the game thread, then build the texture back on it
+    const FString ThumbnailPath = GetThumbnailPath(Photos[PhotoIndex].FilePath);
+    TWeakObjectPtr<UPhotoGallerySubsystem> WeakThis(this);
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ThumbnailPath, WeakThis, PhotoIndex]()
+    {
+        TArray<uint8> CompressedData;
+        FFileHelper::LoadFileToArray(CompressedData, *ThumbnailPath, FILEREAD_Silent);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, PhotoIndex, CompressedData = MoveTemp(CompressedData)]()
+        {
+            if (UPhotoGallerySubsystem* Gallery = WeakThis.Get())
+            {
+                Gallery->OnThumbnailDataLoaded(PhotoIndex, CompressedData);
+            }
+        });
+    });
+
+    return nullptr;
+}
+
+void UPhotoGallerySubsystem::OnThumbnailDataLoaded(int32 PhotoIndex, const TArray<uint8>& CompressedData)
+{
+    PendingThumbnailLoads.Remove(PhotoIndex);
+
+    // Thumbnails are a few KB, decoding one is cheap
+    UTexture2D* Thumbnail = CompressedData.Num() > 0 ? FImageUtils::ImportBufferAsTexture2D(CompressedData) : nullptr;
+    if (!Thumbnail)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Missing thumbnail for photo %d"), PhotoIndex);
+        return;
+    }
+
+    // Make room by dropping the least recently used thumbnail
+    while (ThumbnailLru.Num() >= MaxCachedThumbnails)
+    {
+        ThumbnailCache.Remove(ThumbnailLru[0]);
+        ThumbnailLru.RemoveAt(0);
+    }
+
+    ThumbnailCache.Add(PhotoIndex, Thumbnail);
+    ThumbnailLru.Add(PhotoIndex);
+
+    OnThumbnailLoaded.Broadcast(PhotoIndex, Thumbnail);
+}
+
+void UPhotoGallerySubsystem::TouchThumbnail(int32 PhotoIndex)
+{
+    ThumbnailLru.RemoveSingle(PhotoIndex);
+    ThumbnailLru.Add(PhotoIndex);
+}
\ No newline at end of file
@@ -12,6 +12,86 @@
 #include "Engine/GameViewportClient.h"
 #include "HAL/FileManager.h"
 #include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+#include "Camera/PlayerCameraManager.h"
+#include "SceneManagement.h"
+#include "ConvexVolume.h"
+#include "Vehicles/VehicleRegistrySubsystem.h"
+#include "Vehicles/VehicleSignificanceSubsystem.h"
+#include "World/PhotoGallerySubsystem.h"
+#include "World/WorldServicesSubsystem.h"
+#include "ImageUtils.h"
+#include "Engine/Level.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Misc/FileHelper.h"
+#include "World/StreamingPngWriter.h"
+#include "Components/PrimitiveComponent.h"
+#include "OpenWorldExplorer.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enter Photo Mode"), STAT_EnterPhotoMode, STATGROUP_OpenWorldExplorer);
+DECLARE_CYCLE_STAT(TEXT("Exit Photo Mode"), STAT_ExitPhotoMode, STATGROUP_OpenWorldExplorer);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Photo Readback (ms)"), STAT_PhotoReadbackMs, STATGROUP_OpenWorldExplorer);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Photo Encode (ms)"), STAT_PhotoEncodeMs, STATGROUP_OpenWorldExplorer);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Photo Write (ms)"), STAT_PhotoWriteMs, STATGROUP_OpenWorldExplorer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Photos In Flight"), STAT_PhotosInFlight, STATGROUP_OpenWorldExplorer);
+DECLARE_CYCLE_STAT(TEXT("Photo Mode Freeze"), STAT_PhotoFreezeWorld, STATGROUP_OpenWorldExplorer);
+DECLARE_CYCLE_STAT(TEXT("Photo Mode Thaw"), STAT_PhotoThawWorld, STATGROUP_OpenWorldExplorer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Photo Mode Dormant Actors"), STAT_PhotoDormantActors, STATGROUP_OpenWorldExplorer);
+
+// Uber filter material parameters
+static const FName FilterSaturationParam(TEXT("Saturation"));
+static const FName FilterContrastParam(TEXT("Contrast"));
+static const FName FilterBrightnessParam(TEXT("Brightness"));
+static const FName FilterSepiaParam(TEXT("SepiaAmount"));
+static const FName FilterVignetteParam(TEXT("VignetteIntensity"));
+static const FName FilterTintParam(TEXT("Tint"));
+
+// Everything one photo needs between readback and disk, shared by its encode and write tasks
+struct FPhotoEncodeJob
+{
+    TArray<FColor> Pixels;
+    int32 Width = 0;
+    int32 Height = 0;
+    EPhotoFileFormat Format = EPhotoFileFormat::PNG;
+    int32 Quality = 85;
+    int32 ThumbnailWidth = 256;
+    TArray64<uint8> EncodedData;
+    TArray64<uint8> EncodedThumbnail;
+    FPhotoCaptureResult Result;
+};
+
+// A tiled photo being compressed band by band
+struct FTiledPhotoJob
+{
+    FStreamingPngWriter Writer;
+    int32 Width = 0;
+    int32 Height = 0;
+    bool bOpened = false;
+    bool bCaptureFailed = false;
+    TArray<FColor> Thumbnail;
+    int32 ThumbnailWidth = 0;
+    int32 ThumbnailHeight = 0;
+    FPhotoCaptureResult Result;
+};
+
+// Scale and shift clip space so the photo's pixels X,Y to X+TileWidth,Y+TileHeight fill the tile
+static FMatrix MakeTileProjectionOffset(int32 X, int32 Y, int32 TileWidth, int32 TileHeight, int32 Width, int32 Height)
+{
+    const float ScaleX = (float)Width / TileWidth;
+    const float ScaleY = (float)Height / TileHeight;
+    const float OffsetX = ScaleX - 1.0f - 2.0f * X / TileWidth;
+    const float OffsetY = -(ScaleY - 1.0f - 2.0f * Y / TileHeight);
+    
+    return FMatrix(
+        FPlane(ScaleX, 0.0f, 0.0f, 0.0f),
+        FPlane(0.0f, ScaleY, 0.0f, 0.0f),
+        FPlane(0.0f, 0.0f, 1.0f, 0.0f),
+        FPlane(OffsetX, OffsetY, 0.0f, 1.0f));
+}
 
 UPhotographySystem::UPhotographySystem()
 {
@@ -22,23 +102,88 @@ UPhotographySystem::UPhotographySystem()
     MinFOV = 15.0f;  // Telephoto/zoom
     MaxFOV = 110.0f; // Wide angle
     PhotoResolution = FIntPoint(1920, 1080);
+    bTiledCapture = false;
+    MaxTileSize = 1024;
+    TiledCaptureMemoryBudgetMB = 64;
+    TileCapture = nullptr;
+    TileTarget = nullptr;
+    PhotoFormat = EPhotoFileFormat::PNG;
+    JpegQuality = 85;
+    MaxPhotosInFlight = 4;
+    ThumbnailWidth = 256;
+    VehicleDetectionRange = 50000.0f; // 500m
+    UberFilterMaterial = nullptr;
+    UberFilterInstance = nullptr;
+    bFilterInstancesCreated = false;
+    bFreezeWorldInPhotoMode = true;
+    FrozenVisibleTickInterval = 0.1f;
+    FreezeActorsPerFrame = 256;
+    bFreezeInProgress = false;
+    FreezeLevelIndex = 0;
+    FreezeActorIndex = 0;
+    bThawInProgress = false;
+    ThawTickIndex = 0;
+    ThawBodyIndex = 0;
+    PhotoModeScreenPercentage = 150.0f;
+    DormantActorCount = 0;
+    
+    // Uber filter defaults
+    FPhotoFilterParameters Warm;
+    Warm.Tint = FLinearColor(1.1f, 1.0f, 0.85f);
+    FilterParameters.Add(EPhotoFilter::Warm, Warm);
+    
+    FPhotoFilterParameters Cool;
+    Cool.Tint = FLinearColor(0.85f, 0.95f, 1.1f);
+    FilterParameters.Add(EPhotoFilter::Cool, Cool);
+    
+    FPhotoFilterParameters Vintage;
+    Vintage.Saturation = 0.6f;
+    Vintage.Contrast = 0.9f;
+    Vintage.SepiaAmount = 0.3f;
+    Vintage.VignetteIntensity = 0.5f;
+    FilterParameters.Add(EPhotoFilter::Vintage, Vintage);
+    
+    FPhotoFilterParameters BlackAndWhite;
+    BlackAndWhite.Saturation = 0.0f;
+    FilterParameters.Add(EPhotoFilter::BlackAndWhite, BlackAndWhite);
+    
+    FPhotoFilterParameters Sepia;
+    Sepia.Saturation = 0.0f;
+    Sepia.SepiaAmount = 1.0f;
+    FilterParameters.Add(EPhotoFilter::Sepia, Sepia);
+    
+    FPhotoFilterParameters HighContrast;
+    HighContrast.Contrast = 1.5f;
+    FilterParameters.Add(EPhotoFilter::HighContrast, HighContrast);
+    
+    FPhotoFilterParameters Dramatic;
+    Dramatic.Saturation = 0.8f;
+    Dramatic.Contrast = 1.3f;
+    Dramatic.Brightness = 0.9f;
+    Dramatic.VignetteIntensity = 0.8f;
+    FilterParameters.Add(EPhotoFilter::Dramatic, Dramatic);
+    
+    FPhotoFilterParameters Vibrant;
+    Vibrant.Saturation = 1.4f;
+    Vibrant.Contrast = 1.1f;
+    FilterParameters.Add(EPhotoFilter::Vibrant, Vibrant);
     CurrentFilter = EPhotoFilter::None;
     bInPhotoMode = false;
     bUIVisible = true;
+    bScreenshotRequested = false;
+    CaptureSequence = 0;
+    PhotosInFlight = 0;
+    ImageWrapperModule = nullptr;
+    BurstShotsRemaining = 0;
+    BurstInterval = 0.0f;
+    BurstTimer = 0.0f;
+    CompletedCaptures = MakeShared<TQueue<FPhotoCaptureResult, EQueueMode::Mpsc>, ESPMode::ThreadSafe>();
 }
 
 void UPhotographySystem::BeginPlay()
 {
     Super::BeginPlay();
 
-    // Find the player camera that we'll use for taking photos
-    APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-    if (PlayerController && PlayerController->PlayerCameraManager)
-    {
-        // We'll use the actual player camera when entering photo mode
-        // rather than creating a new camera
-    }
-    
     // Create a post process component for photo filters
     PhotoEffects = NewObject<UPostProcessComponent>(GetOwner());
     PhotoEffects->bEnabled = false;
@@ -47,14 +192,97 @@ void UPhotographySystem::BeginPlay()
     // Set it to unbound so it affects the entire scene when active
     PhotoEffects->bUnbound = true;
     
-    // Load the filter materials here if needed
-    // FilterMaterials can be set up in Blueprint editor
+    // Everything photo mode shows is built now so entering it is only a switch
+    CreateFilterInstances();
+    CreateViewfinderWidget();
+    GetPlayerCamera(Cast<APawn>(GetOwner()));
+    
+    // Ensure screenshot directory exists
+    ScreenshotDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("Screenshots"));
+    IFileManager::Get().MakeDirectory(*ScreenshotDir, true);
+    
+    VehicleTraceDelegate.BindUObject(this, &UPhotographySystem::OnVehicleTraceDone);
+    
+    // Modules can only be loaded on the game thread, workers use this pointer
+    ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+}
+
+void UPhotographySystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Don't leave the world or vehicle significance frozen behind us
+    if (bInPhotoMode || bThawInProgress)
+    {
+        ThawWorld();
+    }
+    
+    if (ViewfinderWidget)
+    {
+        ViewfinderWidget->RemoveFromParent();
+        ViewfinderWidget = nullptr;
+    }
+    
+    // Without our handler a pending request would be compressed and saved by the engine itself next frame
+    if (bScreenshotRequested)
+    {
+        FScreenshotRequest::Reset();
+        bScreenshotRequested = false;
+    }
+    
+    for (const FPendingPhotoCapture& Capture : PendingCaptures)
+    {
+        EnqueueFailedCapture(Capture.FilePath);
+    }
+    PendingCaptures.Reset();
+    
+    if (ScreenshotCapturedHandle.IsValid() && GEngine && GEngine->GameViewport)
+    {
+        GEngine->GameViewport->OnScreenshotCaptured().Remove(ScreenshotCapturedHandle);
+        ScreenshotCapturedHandle.Reset();
+    }
+    
+    // Every write waits on the previous one, so this finishes all photos already taken
+    if (LastWriteTask.IsValid())
+    {
+        FTaskGraphInterface::Get().WaitUntilTaskCompletes(LastWriteTask);
+        LastWriteTask = nullptr;
+    }
+    ProcessCompletedCaptures();
+    
+    Super::EndPlay(EndPlayReason);
 }
 
 void UPhotographySystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+    ProcessCompletedCaptures();
+    RequestNextScreenshot();
+    
+    if (bFreezeInProgress)
+    {
+        ContinueFreezeWorld();
+    }
+    else if (bThawInProgress)
+    {
+        ContinueThawWorld(FreezeActorsPerFrame);
+    }
+    
+    // Burst timing uses real time, photo mode slows the game clock
+    if (BurstShotsRemaining > 0 && bTiledCapture)
+    {
+        StopBurst();
+    }
+    else if (BurstShotsRemaining > 0)
+    {
+        BurstTimer -= FApp::GetDeltaTime();
+        if (BurstTimer <= 0.0f && PhotosInFlight + PendingCaptures.Num() < MaxPhotosInFlight)
+        {
+            BurstTimer = FMath::Max(BurstTimer + BurstInterval, 0.0f);
+            --BurstShotsRemaining;
+            TakePhoto();
+        }
+    }
+
     if (bInPhotoMode)
     {
         // Handle any continuous photo mode functionality
@@ -69,25 +297,21 @@ void UPhotographySystem::EnterPhotoMode()
     if (bInPhotoMode)
         return;
     
+    SCOPE_CYCLE_COUNTER(STAT_EnterPhotoMode);
+    
     APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
     if (!PlayerController)
         return;
     
     // Store original game state
     OriginalGameTimeDilation = UGameplayStatics::GetGlobalTimeDilation(GetWorld());
-    OriginalHUDVisible = PlayerController->GetHUD() ? PlayerController->GetHUD()->bShowHUD : false;
+    bOriginalHUDVisible = PlayerController->GetHUD() ? PlayerController->GetHUD()->bShowHUD : false;
     
     // Store camera transform
-    APawn* ControlledPawn = PlayerController->GetPawn();
-    UCameraComponent* PlayerCamera = nullptr;
-    
-    if (ControlledPawn)
+    UCameraComponent* PlayerCamera = GetPlayerCamera(PlayerController->GetPawn());
+    if (PlayerCamera)
     {
-        PlayerCamera = ControlledPawn->FindComponentByClass<UCameraComponent>();
-        if (PlayerCamera)
-        {
-            OriginalCameraTransform = PlayerCamera->GetComponentTransform();
-        }
+        OriginalCameraTransform = PlayerCamera->GetComponentTransform();
     }
     
     // Enable photo mode
@@ -96,6 +320,12 @@ void UPhotographySystem::EnterPhotoMode()
     // Slow down game time to make it easier to capture perfect shots
     UGameplayStatics::SetGlobalTimeDilation(GetWorld(), 0.1f);
     
+    // Stop what the camera can't see, the frame time saved goes to rendering quality
+    if (bFreezeWorldInPhotoMode)
+    {
+        BeginFreezeWorld(PlayerController);
+    }
+    
     // Hide regular HUD
     if (PlayerController->GetHUD())
     {
@@ -105,19 +335,19 @@ void UPhotographySystem::EnterPhotoMode()
     // Enable post processing for photo effects
     if (PhotoEffects)
     {
+        // Lives in the photo post process so it goes away with it on exit
+        PhotoEffects->Settings.bOverride_ScreenPercentage = bFreezeWorldInPhotoMode;
+        PhotoEffects->Settings.ScreenPercentage = PhotoModeScreenPercentage;
         PhotoEffects->bEnabled = true;
         ApplyCurrentFilter();
     }
     
     // Show photography UI (viewfinder)
-    if (ViewfinderWidgetClass)
+    CreateViewfinderWidget();
+    if (ViewfinderWidget)
     {
-        ViewfinderWidget = CreateWidget<UUserWidget>(PlayerController, ViewfinderWidgetClass);
-        if (ViewfinderWidget)
-        {
-            ViewfinderWidget->AddToViewport();
-            bUIVisible = true;
-        }
+        ViewfinderWidget->SetVisibility(ESlateVisibility::Visible);
+        bUIVisible = true;
     }
     
     // Set input mode that allows both UI and game
@@ -138,31 +368,31 @@ void UPhotographySystem::ExitPhotoMode()
     if (!bInPhotoMode)
         return;
     
+    SCOPE_CYCLE_COUNTER(STAT_ExitPhotoMode);
+    
     APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
     if (!PlayerController)
         return;
     
+    // Shots already taken still finish saving in the background
+    StopBurst();
+    
     // Restore original game state
     UGameplayStatics::SetGlobalTimeDilation(GetWorld(), OriginalGameTimeDilation);
+    BeginThawWorld();
     
     if (PlayerController->GetHUD())
     {
-        PlayerController->GetHUD()->bShowHUD = OriginalHUDVisible;
+        PlayerController->GetHUD()->bShowHUD = bOriginalHUDVisible;
     }
     
     // Restore camera if needed
-    APawn* ControlledPawn = PlayerController->GetPawn();
-    UCameraComponent* PlayerCamera = nullptr;
-    
-    if (ControlledPawn)
+    UCameraComponent* PlayerCamera = GetPlayerCamera(PlayerController->GetPawn());
+    if (PlayerCamera)
     {
-        PlayerCamera = ControlledPawn->FindComponentByClass<UCameraComponent>();
-        if (PlayerCamera)
-        {
-            // We might want to smoothly transition back to normal camera
-            // For now, just reset FOV
-            PlayerCamera->SetFieldOfView(DefaultFOV);
-        }
+        // We might want to smoothly transition back to normal camera
+        // For now, just reset FOV
+        PlayerCamera->SetFieldOfView(DefaultFOV);
     }
     
     // Disable photo post processing
@@ -171,11 +401,10 @@ void UPhotographySystem::ExitPhotoMode()
         PhotoEffects->bEnabled = false;
     }
     
-    // Remove photography UI
+    // Hide photography UI, it stays in the viewport for next time
     if (ViewfinderWidget)
     {
-        ViewfinderWidget->RemoveFromParent();
-        ViewfinderWidget = nullptr;
+        ViewfinderWidget->SetVisibility(ESlateVisibility::Collapsed);
     }
     
     // Reset input mode to game only
@@ -189,6 +418,195 @@ void UPhotographySystem::ExitPhotoMode()
     bInPhotoMode = false;
 }
 
+void UPhotographySystem::BeginFreezeWorld(APlayerController* PlayerController)
+{
+    UWorld* World = GetWorld();
+    
+    // Back in photo mode before the last thaw finished, intervals recorded now must be the original ones
+    if (bThawInProgress)
+    {
+        ThawWorld();
+    }
+    
+    // The player's pawn, whatever rides on it, our owner, the controller and camera keep running so the shot can still be framed.
+    // While driving the pawn is the vehicle and our owner is the character parked in it.
+    FreezeExemptActors.Reset();
+    if (APawn* Pawn = PlayerController->GetPawn())
+    {
+        TArray<AActor*> Riders;
+        Pawn->GetAttachedActors(Riders);
+        FreezeExemptActors.Append(Riders);
+        FreezeExemptActors.Add(Pawn);
+    }
+    FreezeExemptActors.Add(GetOwner());
+    FreezeExemptActors.Add(PlayerController);
+    FreezeExemptActors.Add(PlayerController->PlayerCameraManager);
+    FreezeExemptActors.Add(PlayerController->GetHUD());
+    FreezeExemptActors.Add(World->GetWorldSettings());
+    
+    // Vehicle tiers would undo the freeze and leave ThawWorld restoring intervals that no longer match them
+    if (UVehicleSignificanceSubsystem* VehicleSignificance = World->GetSubsystem<UVehicleSignificanceSubsystem>())
+    {
+        VehicleSignificance->SetScoringPaused(true);
+    }
+    
+    bFreezeInProgress = true;
+    FreezeLevelIndex = 0;
+    FreezeActorIndex = 0;
+}
+
+void UPhotographySystem::ContinueFreezeWorld()
+{
+    SCOPE_CYCLE_COUNTER(STAT_PhotoFreezeWorld);
+    
+    // Walk the levels' actor lists in place, actors spawned meanwhile are appended and still reached
+    const TArray<ULevel*>& Levels = GetWorld()->GetLevels();
+    int32 Budget = FreezeActorsPerFrame;
+    while (Budget > 0 && FreezeLevelIndex < Levels.Num())
+    {
+        ULevel* Level = Levels[FreezeLevelIndex];
+        if (!Level || FreezeActorIndex >= Level->Actors.Num())
+        {
+            ++FreezeLevelIndex;
+            FreezeActorIndex = 0;
+            continue;
+        }
+        
+        AActor* Actor = Level->Actors[FreezeActorIndex++];
+        if (!Actor || Actor->IsPendingKill() || FreezeExemptActors.Contains(Actor))
+            continue;
+        
+        FreezeActor(Actor);
+        --Budget;
+    }
+    
+    if (FreezeLevelIndex >= Levels.Num())
+    {
+        bFreezeInProgress = false;
+        FreezeExemptActors.Reset();
+    }
+    
+    SET_DWORD_STAT(STAT_PhotoDormantActors, DormantActorCount);
+}
+
+void UPhotographySystem::FreezeActor(AActor* Actor)
+{
+    // Offscreen actors stop, visible ones only slow down so the shot still looks alive
+    const bool bDormant = !Actor->WasRecentlyRendered(0.1f);
+    
+    if (Actor->IsActorTickEnabled())
+    {
+        FrozenTicks.Add({ Actor, Actor->GetActorTickInterval() });
+        if (bDormant)
+        {
+            Actor->SetActorTickEnabled(false);
+        }
+        else
+        {
+            Actor->SetActorTickInterval(FMath::Max(Actor->GetActorTickInterval(), FrozenVisibleTickInterval));
+        }
+    }
+    
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        if (!Component || !Component->IsComponentTickEnabled())
+            continue;
+        
+        FrozenTicks.Add({ Component, Component->GetComponentTickInterval() });
+        if (bDormant)
+        {
+            Component->SetComponentTickEnabled(false);
+        }
+        else
+        {
+            Component->SetComponentTickInterval(FMath::Max(Component->GetComponentTickInterval(), FrozenVisibleTickInterval));
+        }
+    }
+    
+    if (!bDormant)
+        return;
+    
+    ++DormantActorCount;
+    
+    // Nothing offscreen needs simulating, remember velocities so bodies carry on where they were
+    UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+    if (Root && Root->IsSimulatingPhysics() && Root->IsAnyRigidBodyAwake())
+    {
+        SleepingBodies.Add({ Root, Root->GetPhysicsLinearVelocity(), Root->GetPhysicsAngularVelocityInDegrees() });
+        Root->PutAllRigidBodiesToSleep();
+    }
+}
+
+void UPhotographySystem::BeginThawWorld()
+{
+    // Stop a freeze that hasn't finished, only what it already changed needs putting back
+    bFreezeInProgress = false;
+    FreezeExemptActors.Reset();
+    
+    bThawInProgress = true;
+    ThawTickIndex = 0;
+    ThawBodyIndex = 0;
+}
+
+void UPhotographySystem::ContinueThawWorld(int32 Budget)
+{
+    SCOPE_CYCLE_COUNTER(STAT_PhotoThawWorld);
+    
+    // Put back exactly what was changed, anything destroyed meanwhile is skipped
+    while (Budget > 0 && ThawTickIndex < FrozenTicks.Num())
+    {
+        const FFrozenTick& Frozen = FrozenTicks[ThawTickIndex++];
+        if (AActor* Actor = Cast<AActor>(Frozen.Object.Get()))
+        {
+            Actor->SetActorTickInterval(Frozen.TickInterval);
+            Actor->SetActorTickEnabled(true);
+        }
+        else if (UActorComponent* Component = Cast<UActorComponent>(Frozen.Object.Get()))
+        {
+            Component->SetComponentTickInterval(Frozen.TickInterval);
+            Component->SetComponentTickEnabled(true);
+        }
+        --Budget;
+    }
+    
+    while (Budget > 0 && ThawBodyIndex < SleepingBodies.Num())
+    {
+        const FSleepingBody& Sleeping = SleepingBodies[ThawBodyIndex++];
+        UPrimitiveComponent* Body = Sleeping.Body.Get();
+        if (!Body || !Body->IsSimulatingPhysics())
+            continue;
+        
+        Body->WakeAllRigidBodies();
+        Body->SetPhysicsLinearVelocity(Sleeping.LinearVelocity);
+        Body->SetPhysicsAngularVelocityInDegrees(Sleeping.AngularVelocity);
+        --Budget;
+    }
+    
+    if (ThawTickIndex < FrozenTicks.Num() || ThawBodyIndex < SleepingBodies.Num())
+        return;
+    
+    bThawInProgress = false;
+    FrozenTicks.Reset();
+    SleepingBodies.Reset();
+    DormantActorCount = 0;
+    SET_DWORD_STAT(STAT_PhotoDormantActors, 0);
+    
+    // Everything is back as it was before the freeze, tiers carry on from there
+    if (UVehicleSignificanceSubsystem* VehicleSignificance = GetWorld()->GetSubsystem<UVehicleSignificanceSubsystem>())
+    {
+        VehicleSignificance->SetScoringPaused(false);
+    }
+}
+
+void UPhotographySystem::ThawWorld()
+{
+    if (!bThawInProgress)
+    {
+        BeginThawWorld();
+    }
+    ContinueThawWorld(MAX_int32);
+}
+
 void UPhotographySystem::TakePhoto()
 {
     if (!bInPhotoMode)
@@ -206,18 +624,22 @@ void UPhotographySystem::TakePhoto()
     UGameplayStatics::PlaySound2D(GetWorld(), nullptr); // Add your camera sound effect here
     
     // Take a screenshot
-    CaptureScreenshot();
+    const FString PhotoPath = bTiledCapture ? CaptureTiledScreenshot() : CaptureScreenshot();
     
     // Generate photo metadata
     FPhotoMetadata Metadata = GeneratePhotoMetadata();
+    Metadata.FilePath = PhotoPath;
     
     // Register the photo with progression system
-    UProgressionSystem* ProgressionSystem = Cast<UProgressionSystem>(UGameplayStatics::GetGameInstance(GetWorld())->GetSubsystem<UProgressionSystem>());
+    UProgressionSystem* ProgressionSystem = GetProgressionSystem();
     if (ProgressionSystem && !Metadata.LocationName.IsEmpty())
     {
         ProgressionSystem->RegisterLocationPhotographed(Metadata.LocationName);
     }
     
+    // Vehicles in the shot are added once their visibility traces return
+    DetectVehiclesInFrame(MoveTemp(Metadata));
+    
     // Show UI again if it was visible
     if (bWasUIVisible && ViewfinderWidget)
     {
@@ -226,6 +648,28 @@ void UPhotographySystem::TakePhoto()
     }
 }
 
+void UPhotographySystem::StartBurst(int32 ShotCount, float ShotsPerSecond)
+{
+    if (!bInPhotoMode || ShotCount <= 0 || ShotsPerSecond <= 0.0f)
+        return;
+    
+    // Every tiled photo renders all its tiles in one frame, a burst of them would be a run of long stalls
+    if (bTiledCapture)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Burst isn't available with tiled capture, take single photos instead"));
+        return;
+    }
+    
+    BurstShotsRemaining = ShotCount;
+    BurstInterval = 1.0f / ShotsPerSecond;
+    BurstTimer = 0.0f;
+}
+
+void UPhotographySystem::StopBurst()
+{
+    BurstShotsRemaining = 0;
+}
+
 void UPhotographySystem::SetFilter(EPhotoFilter NewFilter)
 {
     if (CurrentFilter == NewFilter)
@@ -276,19 +720,13 @@ void UPhotographySystem::AdjustZoom(float ZoomAmount)
     if (!PlayerController)
         return;
     
-    APawn* ControlledPawn = PlayerController->GetPawn();
-    UCameraComponent* PlayerCamera = nullptr;
-    
-    if (ControlledPawn)
+    UCameraComponent* PlayerCamera = GetPlayerCamera(PlayerController->GetPawn());
+    if (PlayerCamera)
     {
-        PlayerCamera = ControlledPawn->FindComponentByClass<UCameraComponent>();
-        if (PlayerCamera)
-        {
-            // Adjust FOV (lower FOV = more zoom)
-            float CurrentFOV = PlayerCamera->FieldOfView;
-            float NewFOV = FMath::Clamp(CurrentFOV - ZoomAmount, MinFOV, MaxFOV);
-            PlayerCamera->SetFieldOfView(NewFOV);
-        }
+        // Adjust FOV (lower FOV = more zoom)
+        float CurrentFOV = PlayerCamera->FieldOfView;
+        float NewFOV = FMath::Clamp(CurrentFOV - ZoomAmount, MinFOV, MaxFOV);
+        PlayerCamera->SetFieldOfView(NewFOV);
     }
 }
 
@@ -309,63 +747,518 @@ void UPhotographySystem::ToggleUI()
     }
 }
 
+void UPhotographySystem::CreateViewfinderWidget()
+{
+    if (ViewfinderWidget || !ViewfinderWidgetClass)
+        return;
+    
+    // The pawn may not be possessed yet at BeginPlay, photo mode will try again
+    APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+    if (!PlayerController)
+        return;
+    
+    ViewfinderWidget = CreateWidget<UUserWidget>(PlayerController, ViewfinderWidgetClass);
+    if (ViewfinderWidget)
+    {
+        ViewfinderWidget->SetVisibility(ESlateVisibility::Collapsed);
+        ViewfinderWidget->AddToViewport();
+    }
+}
+
+UCameraComponent* UPhotographySystem::GetPlayerCamera(APawn* Pawn)
+{
+    // Only search again when the player is controlling a different pawn
+    if (CachedCameraPawn.Get() != Pawn || !CachedPlayerCamera.IsValid())
+    {
+        CachedCameraPawn = Pawn;
+        CachedPlayerCamera = Pawn ? Pawn->FindComponentByClass<UCameraComponent>() : nullptr;
+    }
+    
+    return CachedPlayerCamera.Get();
+}
+
+void UPhotographySystem::CreateFilterInstances()
+{
+    if (bFilterInstancesCreated || !PhotoEffects)
+        return;
+    
+    bFilterInstancesCreated = true;
+    
+    TArray<FWeightedBlendable>& Blendables = PhotoEffects->Settings.WeightedBlendables.Array;
+    Blendables.Empty();
+    
+    // One material for every filter, switching only changes its parameters
+    if (UberFilterMaterial)
+    {
+        UberFilterInstance = UMaterialInstanceDynamic::Create(UberFilterMaterial, this);
+        Blendables.Add(FWeightedBlendable(0.0f, UberFilterInstance));
+        return;
+    }
+    
+    // Otherwise every filter material stays in the blendables and is switched by weight
+    for (const TPair<EPhotoFilter, UMaterialInterface*>& Filter : FilterMaterials)
+    {
+        if (!Filter.Value)
+            continue;
+        
+        UMaterialInstanceDynamic* DynamicMaterial = UMaterialInstanceDynamic::Create(Filter.Value, this);
+        FilterInstances.Add(Filter.Key, DynamicMaterial);
+        FilterBlendableIndex.Add(Filter.Key, Blendables.Add(FWeightedBlendable(0.0f, DynamicMaterial)));
+    }
+}
+
 void UPhotographySystem::ApplyCurrentFilter()
 {
     if (!PhotoEffects)
         return;
     
-    UMaterialInterface* FilterMaterial = nullptr;
+    CreateFilterInstances();
+    
+    TArray<FWeightedBlendable>& Blendables = PhotoEffects->Settings.WeightedBlendables.Array;
+    
+    if (UberFilterInstance)
+    {
+        const FPhotoFilterParameters* Parameters = FilterParameters.Find(CurrentFilter);
+        if (Parameters && CurrentFilter != EPhotoFilter::None)
+        {
+            UberFilterInstance->SetScalarParameterValue(FilterSaturationParam, Parameters->Saturation);
+            UberFilterInstance->SetScalarParameterValue(FilterContrastParam, Parameters->Contrast);
+            UberFilterInstance->SetScalarParameterValue(FilterBrightnessParam, Parameters->Brightness);
+            UberFilterInstance->SetScalarParameterValue(FilterSepiaParam, Parameters->SepiaAmount);
+            UberFilterInstance->SetScalarParameterValue(FilterVignetteParam, Parameters->VignetteIntensity);
+            UberFilterInstance->SetVectorParameterValue(FilterTintParam, Parameters->Tint);
+            Blendables[0].Weight = 1.0f;
+        }
+        else
+        {
+            // No filter, skip the pass entirely
+            Blendables[0].Weight = 0.0f;
+        }
+        return;
+    }
     
-    // Get the material for the current filter
-    if (FilterMaterials.Contains(CurrentFilter))
+    for (const TPair<EPhotoFilter, int32>& Filter : FilterBlendableIndex)
     {
-        FilterMaterial = FilterMaterials[CurrentFilter];
+        Blendables[Filter.Value].Weight = Filter.Key == CurrentFilter ? 1.0f : 0.0f;
     }
+}
+
+FString UPhotographySystem::CaptureScreenshot()
+{
+    FPendingPhotoCapture& Capture = PendingCaptures.AddDefaulted_GetRef();
+    Capture.FilePath = MakePhotoFilePath(PhotoFormat);
+    Capture.RequestTime = FPlatformTime::Seconds();
+    
+    const FString PhotoPath = Capture.FilePath;
+    RequestNextScreenshot();
     
-    // If we have a valid material, apply it as a post process effect
-    if (FilterMaterial)
+    return PhotoPath;
+}
+
+void UPhotographySystem::RequestNextScreenshot()
+{
+    if (bScreenshotRequested || PendingCaptures.Num() == 0 || !GEngine || !GEngine->GameViewport)
+        return;
+    
+    // While we listen for the pixels the engine skips its own compress and save
+    if (!ScreenshotCapturedHandle.IsValid())
     {
-        // Create a dynamic instance of the material
-        UMaterialInstanceDynamic* DynamicMaterial = UMaterialInstanceDynamic::Create(FilterMaterial, this);
+        ScreenshotCapturedHandle = GEngine->GameViewport->OnScreenshotCaptured().AddUObject(this, &UPhotographySystem::OnScreenshotCaptured);
+    }
+    
+    FScreenshotRequest::RequestScreenshot(PendingCaptures[0].FilePath, false, false);
+    bScreenshotRequested = true;
+}
+
+void UPhotographySystem::OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Pixels)
+{
+    if (PendingCaptures.Num() == 0)
+        return;
+    
+    const FPendingPhotoCapture Capture = PendingCaptures[0];
+    PendingCaptures.RemoveAt(0);
+    bScreenshotRequested = false;
+    
+    // Stop intercepting screenshots once ours are done
+    if (PendingCaptures.Num() == 0 && GEngine && GEngine->GameViewport)
+    {
+        GEngine->GameViewport->OnScreenshotCaptured().Remove(ScreenshotCapturedHandle);
+        ScreenshotCapturedHandle.Reset();
+    }
+    
+    if (!ImageWrapperModule || Pixels.Num() != Width * Height)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Screenshot for %s came back with %d pixels for %dx%d, dropping it"), *Capture.FilePath, Pixels.Num(), Width, Height);
+        EnqueueFailedCapture(Capture.FilePath);
+        return;
+    }
+    
+    TSharedRef<FPhotoEncodeJob, ESPMode::ThreadSafe> Job = MakeShared<FPhotoEncodeJob, ESPMode::ThreadSafe>();
+    Job->Pixels = Pixels;
+    Job->Width = Width;
+    Job->Height = Height;
+    Job->Format = PhotoFormat;
+    Job->Quality = JpegQuality;
+    Job->ThumbnailWidth = FMath::Min(ThumbnailWidth, Width);
+    Job->Result.FilePath = Capture.FilePath;
+    Job->Result.ReadbackMs = (float)((FPlatformTime::Seconds() - Capture.RequestTime) * 1000.0);
+    
+    // Encode on any worker, several photos can compress at once
+    IImageWrapperModule* WrapperModule = ImageWrapperModule;
+    FGraphEventRef EncodeTask = FFunctionGraphTask::CreateAndDispatchWhenReady([Job, WrapperModule]()
+    {
+        const double StartTime = FPlatformTime::Seconds();
         
-        // Apply the material to the post process component
-        PhotoEffects->Settings.WeightedBlendables.Array.Empty();
+        // The frame's alpha isn't meaningful, make the image opaque
+        for (FColor& Pixel : Job->Pixels)
+        {
+            Pixel.A = 255;
+        }
+        
+        const bool bJpeg = Job->Format == EPhotoFileFormat::JPEG;
+        TSharedPtr<IImageWrapper> ImageWrapper = WrapperModule->CreateImageWrapper(bJpeg ? EImageFormat::JPEG : EImageFormat::PNG);
+        if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(Job->Pixels.GetData(), Job->Pixels.Num() * sizeof(FColor), Job->Width, Job->Height, ERGBFormat::BGRA, 8))
+        {
+            Job->EncodedData = ImageWrapper->GetCompressed(bJpeg ? Job->Quality : 0);
+        }
+        
+        // Small JPEG for the gallery so browsing never loads the full image
+        const int32 ThumbnailHeight = FMath::Max(Job->Height * Job->ThumbnailWidth / FMath::Max(Job->Width, 1), 1);
+        TArray<FColor> ThumbnailPixels;
+        FImageUtils::ImageResize(Job->Width, Job->Height, Job->Pixels, Job->ThumbnailWidth, ThumbnailHeight, ThumbnailPixels, false);
+        
+        TSharedPtr<IImageWrapper> ThumbnailWrapper = WrapperModule->CreateImageWrapper(EImageFormat::JPEG);
+        if (ThumbnailWrapper.IsValid() && ThumbnailWrapper->SetRaw(ThumbnailPixels.GetData(), ThumbnailPixels.Num() * sizeof(FColor), Job->ThumbnailWidth, ThumbnailHeight, ERGBFormat::BGRA, 8))
+        {
+            Job->EncodedThumbnail = ThumbnailWrapper->GetCompressed(80);
+        }
         
-        FWeightedBlendable Blendable;
-        Blendable.Object = DynamicMaterial;
-        Blendable.Weight = 1.0f;
+        // Release the raw frame as soon as possible
+        Job->Pixels.Empty();
         
-        PhotoEffects->Settings.WeightedBlendables.Array.Add(Blendable);
+        Job->Result.EncodeMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+    
+    // Writes go through one ordered queue so burst shots don't compete for the disk
+    FGraphEventArray WritePrerequisites;
+    WritePrerequisites.Add(EncodeTask);
+    if (LastWriteTask.IsValid())
+    {
+        WritePrerequisites.Add(LastWriteTask);
     }
-    else
+    
+    TSharedPtr<TQueue<FPhotoCaptureResult, EQueueMode::Mpsc>, ESPMode::ThreadSafe> Completed = CompletedCaptures;
+    LastWriteTask = FFunctionGraphTask::CreateAndDispatchWhenReady([Job, Completed]()
     {
-        // No filter, clear any post process effects
-        PhotoEffects->Settings.WeightedBlendables.Array.Empty();
+        const double StartTime = FPlatformTime::Seconds();
+        
+        if (Job->EncodedData.Num() > 0)
+        {
+            TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Job->Result.FilePath));
+            if (Writer)
+            {
+                Writer->Serialize(Job->EncodedData.GetData(), Job->EncodedData.Num());
+                Job->Result.bSaved = Writer->Close();
+            }
+        }
+        
+        if (Job->EncodedThumbnail.Num() > 0)
+        {
+            TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*UPhotoGallerySubsystem::GetThumbnailPath(Job->Result.FilePath)));
+            if (Writer)
+            {
+                Writer->Serialize(Job->EncodedThumbnail.GetData(), Job->EncodedThumbnail.Num());
+                Writer->Close();
+            }
+        }
+        
+        Job->EncodedData.Empty();
+        Job->EncodedThumbnail.Empty();
+        Job->Result.WriteMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+        
+        Completed->Enqueue(Job->Result);
+    }, TStatId(), &WritePrerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+    
+    ++PhotosInFlight;
+    INC_DWORD_STAT(STAT_PhotosInFlight);
+}
+
+FString UPhotographySystem::CaptureTiledScreenshot()
+{
+    APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+    if (!PlayerController || !PlayerController->PlayerCameraManager || !ImageWrapperModule)
+        return FString();
+    
+    const int32 Width = FMath::Max(PhotoResolution.X, 1);
+    const int32 Height = FMath::Max(PhotoResolution.Y, 1);
+    
+    // Each row of tiles is one band, one band fills while the one before compresses, plus the tile readback
+    const int64 BudgetBytes = (int64)TiledCaptureMemoryBudgetMB * 1024 * 1024;
+    const int32 TileWidth = FMath::Min(Width, MaxTileSize);
+    const int64 BytesPerTileRow = ((int64)Width * 2 + TileWidth) * sizeof(FColor);
+    const int32 TileHeight = (int32)FMath::Min<int64>(FMath::Min(Height, MaxTileSize), BudgetBytes / BytesPerTileRow);
+    if (TileHeight < 1)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("A %dx%d photo doesn't fit the %d MB tiled capture budget"), Width, Height, TiledCaptureMemoryBudgetMB);
+        return FString();
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    CreateTileCapture(TileWidth, TileHeight);
+    
+    // Projection for the whole photo from the player's view, each tile renders a window of it
+    APlayerCameraManager* CameraManager = PlayerController->PlayerCameraManager;
+    TileCapture->SetWorldLocationAndRotation(CameraManager->GetCameraLocation(), CameraManager->GetCameraRotation());
+    const float HalfFOV = FMath::DegreesToRadians(CameraManager->GetFOVAngle()) * 0.5f;
+    const FMatrix FrameProjection = FReversedZPerspectiveMatrix(HalfFOV, HalfFOV, 1.0f, (float)Width / Height, GNearClippingPlane, GNearClippingPlane);
+    
+    // The photo filter reaches the capture through the unbound volume, its vignette would land on every tile too
+    UMaterialInstanceDynamic* VignetteFilter = UberFilterInstance ? UberFilterInstance : FilterInstances.FindRef(CurrentFilter);
+    float FilterVignette = 0.0f;
+    const bool bHoldFilterVignette = VignetteFilter && VignetteFilter->GetScalarParameterValue(FMaterialParameterInfo(FilterVignetteParam), FilterVignette) && FilterVignette != 0.0f;
+    if (bHoldFilterVignette)
+    {
+        VignetteFilter->SetScalarParameterValue(FilterVignetteParam, 0.0f);
     }
+    
+    // Meter exposure on the whole frame once, then hold it so tiles match
+    TileCapture->CustomProjectionMatrix = FrameProjection;
+    TileCapture->PostProcessSettings.bOverride_AutoExposureSpeedUp = false;
+    TileCapture->PostProcessSettings.bOverride_AutoExposureSpeedDown = false;
+    TileCapture->bCameraCutThisFrame = true;
+    TileCapture->CaptureScene();
+    TileCapture->PostProcessSettings.bOverride_AutoExposureSpeedUp = true;
+    TileCapture->PostProcessSettings.bOverride_AutoExposureSpeedDown = true;
+    
+    TSharedRef<FTiledPhotoJob, ESPMode::ThreadSafe> Job = MakeShared<FTiledPhotoJob, ESPMode::ThreadSafe>();
+    Job->Width = Width;
+    Job->Height = Height;
+    Job->ThumbnailWidth = FMath::Min(ThumbnailWidth, Width);
+    Job->ThumbnailHeight = FMath::Max(Height * Job->ThumbnailWidth / Width, 1);
+    Job->Thumbnail.SetNumZeroed(Job->ThumbnailWidth * Job->ThumbnailHeight);
+    Job->Result.FilePath = MakePhotoFilePath(EPhotoFileFormat::PNG);
+    
+    // Photos reach the disk in the order they were taken
+    FGraphEventArray OpenPrerequisites;
+    if (LastWriteTask.IsValid())
+    {
+        OpenPrerequisites.Add(LastWriteTask);
+    }
+    FGraphEventRef PreviousTask = FFunctionGraphTask::CreateAndDispatchWhenReady([Job]()
+    {
+        Job->bOpened = Job->Writer.Open(Job->Result.FilePath, Job->Width, Job->Height);
+    }, TStatId(), &OpenPrerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+    FGraphEventRef OlderTask;
+    
+    FTextureRenderTargetResource* TileResource = TileTarget->GameThread_GetRenderTargetResource();
+    TArray<FColor> TilePixels;
+    
+    for (int32 BandY = 0; BandY < Height; BandY += TileHeight)
+    {
+        const int32 BandHeight = FMath::Min(TileHeight, Height - BandY);
+        
+        // Stay within budget, the band before last must be compressed before its memory is reused
+        if (OlderTask.IsValid())
+        {
+            FTaskGraphInterface::Get().WaitUntilTaskCompletes(OlderTask);
+        }
+        
+        TArray<FColor> Band;
+        Band.SetNumUninitialized(Width * BandHeight);
+        
+        for (int32 TileX = 0; TileX < Width; TileX += TileWidth)
+        {
+            TileCapture->CustomProjectionMatrix = FrameProjection * MakeTileProjectionOffset(TileX, BandY, TileWidth, TileHeight, Width, Height);
+            TileCapture->CaptureScene();
+            
+            if (!TileResource || !TileResource->ReadPixels(TilePixels) || TilePixels.Num() != TileWidth * TileHeight)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Failed to read back photo tile at %d,%d"), TileX, BandY);
+                Job->bCaptureFailed = true;
+                break;
+            }
+            
+            // Edge tiles hang over the photo, only the part inside is kept
+            const int32 CopyWidth = FMath::Min(TileWidth, Width - TileX);
+            for (int32 Row = 0; Row < BandHeight; ++Row)
+            {
+                FMemory::Memcpy(&Band[Row * Width + TileX], &TilePixels[Row * TileWidth], CopyWidth * sizeof(FColor));
+            }
+        }
+        
+        if (Job->bCaptureFailed)
+            break;
+        
+        FGraphEventArray BandPrerequisites;
+        BandPrerequisites.Add(PreviousTask);
+        OlderTask = PreviousTask;
+        PreviousTask = FFunctionGraphTask::CreateAndDispatchWhenReady([Job, Band = MoveTemp(Band), BandY, BandHeight]()
+        {
+            if (!Job->bOpened)
+                return;
+            
+            const double EncodeStart = FPlatformTime::Seconds();
+            Job->Writer.WriteRows(Band.GetData(), BandHeight);
+            
+            // Sample the thumbnail rows that fall in this band
+            for (int32 ThumbY = 0; ThumbY < Job->ThumbnailHeight; ++ThumbY)
+            {
+                const int32 SourceY = ThumbY * Job->Height / Job->ThumbnailHeight - BandY;
+                if (SourceY < 0 || SourceY >= BandHeight)
+                    continue;
+                
+                for (int32 ThumbX = 0; ThumbX < Job->ThumbnailWidth; ++ThumbX)
+                {
+                    FColor Pixel = Band[SourceY * Job->Width + ThumbX * Job->Width / Job->ThumbnailWidth];
+                    Pixel.A = 255;
+                    Job->Thumbnail[ThumbY * Job->ThumbnailWidth + ThumbX] = Pixel;
+                }
+            }
+            
+            Job->Result.EncodeMs += (float)((FPlatformTime::Seconds() - EncodeStart) * 1000.0);
+        }, TStatId(), &BandPrerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+    }
+    
+    Job->Result.ReadbackMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    
+    if (bHoldFilterVignette)
+    {
+        VignetteFilter->SetScalarParameterValue(FilterVignetteParam, FilterVignette);
+    }
+    
+    FGraphEventArray ClosePrerequisites;
+    ClosePrerequisites.Add(PreviousTask);
+    IImageWrapperModule* WrapperModule = ImageWrapperModule;
+    TSharedPtr<TQueue<FPhotoCaptureResult, EQueueMode::Mpsc>, ESPMode::ThreadSafe> Completed = CompletedCaptures;
+    LastWriteTask = FFunctionGraphTask::CreateAndDispatchWhenReady([Job, WrapperModule, Completed]()
+    {
+        const double WriteStart = FPlatformTime::Seconds();
+        
+        // A missing band leaves the image short, Close reports that as a failure
+        Job->Result.bSaved = Job->bOpened && Job->Writer.Close() && !Job->bCaptureFailed;
+        
+        if (Job->Result.bSaved)
+        {
+            TSharedPtr<IImageWrapper> ThumbnailWrapper = WrapperModule->CreateImageWrapper(EImageFormat::JPEG);
+            if (ThumbnailWrapper.IsValid() && ThumbnailWrapper->SetRaw(Job->Thumbnail.GetData(), Job->Thumbnail.Num() * sizeof(FColor), Job->ThumbnailWidth, Job->ThumbnailHeight, ERGBFormat::BGRA, 8))
+            {
+                const TArray64<uint8> EncodedThumbnail = ThumbnailWrapper->GetCompressed(80);
+                FFileHelper::SaveArrayToFile(EncodedThumbnail, *UPhotoGallerySubsystem::GetThumbnailPath(Job->Result.FilePath));
+            }
+        }
+        else
+        {
+            IFileManager::Get().Delete(*Job->Result.FilePath, false, false, true);
+        }
+        
+        Job->Thumbnail.Empty();
+        Job->Result.WriteMs = (float)((FPlatformTime::Seconds() - WriteStart) * 1000.0);
+        
+        Completed->Enqueue(Job->Result);
+    }, TStatId(), &ClosePrerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+    
+    ++PhotosInFlight;
+    INC_DWORD_STAT(STAT_PhotosInFlight);
+    
+    return Job->Result.FilePath;
 }
 
-void UPhotographySystem::CaptureScreenshot()
+void UPhotographySystem::CreateTileCapture(int32 TileWidth, int32 TileHeight)
 {
-    // Ensure screenshot directory exists
-    FString ScreenshotDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("Screenshots"));
-    IFileManager::Get().MakeDirectory(*ScreenshotDir, true);
+    if (!TileCapture)
+    {
+        TileCapture = NewObject<USceneCaptureComponent2D>(GetOwner());
+        TileCapture->bCaptureEveryFrame = false;
+        TileCapture->bCaptureOnMovement = false;
+        TileCapture->bAlwaysPersistRenderingState = true;
+        TileCapture->bUseCustomProjectionMatrix = true;
+        TileCapture->CaptureSource = ESceneCaptureSource::SCS_FinalColorLDR;
+        
+        // Screen space vignette would darken every tile's edges
+        TileCapture->PostProcessSettings.bOverride_VignetteIntensity = true;
+        TileCapture->PostProcessSettings.VignetteIntensity = 0.0f;
+        
+        // History persists for the held exposure, temporal AA and motion blur would smear the last tile into the next
+        TileCapture->ShowFlags.SetTemporalAA(false);
+        TileCapture->ShowFlags.SetMotionBlur(false);
+        TileCapture->PostProcessSettings.AutoExposureSpeedUp = 0.0f;
+        TileCapture->PostProcessSettings.AutoExposureSpeedDown = 0.0f;
+        TileCapture->RegisterComponent();
+    }
     
-    // Generate a unique filename with timestamp
-    FDateTime Now = FDateTime::Now();
-    FString Timestamp = Now.ToString(TEXT("%Y%m%d_%H%M%S"));
-    FString FileName = FString::Printf(TEXT("OpenWorldExplorer_Photo_%s.png"), *Timestamp);
-    FString FilePath = ScreenshotDir / FileName;
+    if (!TileTarget)
+    {
+        TileTarget = NewObject<UTextureRenderTarget2D>(this);
+    }
     
-    // Setup high-resolution screenshot parameters
-    GetHighResScreenshotConfig().FilenameOverride = FilePath;
-    GetHighResScreenshotConfig().SetResolution(PhotoResolution.X, PhotoResolution.Y);
-    GetHighResScreenshotConfig().bMaskEnabled = false;
+    if (TileTarget->SizeX != TileWidth || TileTarget->SizeY != TileHeight)
+    {
+        TileTarget->InitCustomFormat(TileWidth, TileHeight, PF_B8G8R8A8, false);
+    }
     
-    // Take the screenshot
-    FScreenshotRequest::RequestScreenshot(FilePath, false, false);
+    TileCapture->TextureTarget = TileTarget;
+}
+
+void UPhotographySystem::ProcessCompletedCaptures()
+{
+    FPhotoCaptureResult Result;
+    while (CompletedCaptures->Dequeue(Result))
+    {
+        --PhotosInFlight;
+        DEC_DWORD_STAT(STAT_PhotosInFlight);
+        
+        SET_FLOAT_STAT(STAT_PhotoReadbackMs, Result.ReadbackMs);
+        SET_FLOAT_STAT(STAT_PhotoEncodeMs, Result.EncodeMs);
+        SET_FLOAT_STAT(STAT_PhotoWriteMs, Result.WriteMs);
+        
+        if (Result.bSaved)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Photo captured to: %s (readback %.1f ms, encode %.1f ms, write %.1f ms)"),
+                *Result.FilePath, Result.ReadbackMs, Result.EncodeMs, Result.WriteMs);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to save photo: %s"), *Result.FilePath);
+        }
+        
+        // Failed photos never reach the gallery
+        FPhotoMetadata Metadata;
+        if (MetadataAwaitingSave.RemoveAndCopyValue(Result.FilePath, Metadata))
+        {
+            if (Result.bSaved)
+            {
+                CatalogPhoto(Metadata);
+            }
+        }
+        else
+        {
+            SaveResultsAwaitingMetadata.Add(Result.FilePath, Result.bSaved);
+        }
+        
+        LastCaptureResult = Result;
+    }
+}
+
+void UPhotographySystem::EnqueueFailedCapture(const FString& FilePath)
+{
+    FPhotoCaptureResult Result;
+    Result.FilePath = FilePath;
+    CompletedCaptures->Enqueue(Result);
     
-    // Log the capture for debugging
-    UE_LOG(LogTemp, Log, TEXT("Photo captured to: %s"), *FilePath);
+    // Balanced when ProcessCompletedCaptures picks the result up
+    ++PhotosInFlight;
+    INC_DWORD_STAT(STAT_PhotosInFlight);
+}
+
+FString UPhotographySystem::MakePhotoFilePath(EPhotoFileFormat Format)
+{
+    // Milliseconds plus a session counter so burst shots never share a name
+    FDateTime Now = FDateTime::Now();
+    FString Timestamp = Now.ToString(TEXT("%Y%m%d_%H%M%S_%s"));
+    const TCHAR* Extension = Format == EPhotoFileFormat::JPEG ? TEXT("jpg") : TEXT("png");
+    FString FileName = FString::Printf(TEXT("OpenWorldExplorer_Photo_%s_%04d.%s"), *Timestamp, CaptureSequence++, Extension);
+    
+    return ScreenshotDir / FileName;
 }
 
 FPhotoMetadata UPhotographySystem::GeneratePhotoMetadata()
@@ -386,7 +1279,7 @@ FPhotoMetadata UPhotographySystem::GeneratePhotoMetadata()
     Metadata.WeatherCondition = GetCurrentWeatherCondition();
     
     // Get time of day from world manager
-    AWorldManager* WorldManager = Cast<AWorldManager>(UGameplayStatics::GetActorOfClass(GetWorld(), AWorldManager::StaticClass()));
+    AWorldManager* WorldManager = GetWorldManager();
     if (WorldManager)
     {
         Metadata.TimeOfDay = WorldManager->GetTimeOfDay();
@@ -398,9 +1291,6 @@ FPhotoMetadata UPhotographySystem::GeneratePhotoMetadata()
     // Detect location name
     Metadata.LocationName = DetectNearbyLocationName();
     
-    // Detect vehicles in frame
-    Metadata.CapturedVehicles = DetectVehiclesInFrame();
-    
     return Metadata;
 }
 
@@ -414,29 +1304,14 @@ FString UPhotographySystem::DetectNearbyLocationName()
         FVector PlayerLocation = PlayerController->GetPawn()->GetActorLocation();
         
         // Get progression system to check discovered locations
-        UProgressionSystem* ProgressionSystem = Cast<UProgressionSystem>(UGameplayStatics::GetGameInstance(GetWorld())->GetSubsystem<UProgressionSystem>());
+        UProgressionSystem* ProgressionSystem = GetProgressionSystem();
         if (ProgressionSystem)
         {
-            // Get all discovered locations
-            TArray<FDiscoveredLocation> Locations = ProgressionSystem->GetDiscoveredLocations();
-            
-            // Find the closest one within a certain range
-            float ClosestDistanceSq = 1000000.0f * 1000000.0f; // 1000m squared
-            for (const FDiscoveredLocation& Location : Locations)
+            // Only return the closest location if we're within a reasonable distance
+            const FDiscoveredLocation* NearestLocation = ProgressionSystem->FindNearestDiscoveredLocation(PlayerLocation, 500.0f);
+            if (NearestLocation)
             {
-                float DistanceSq = FVector::DistSquared(PlayerLocation, Location.LocationCoordinates);
-                
-                if (DistanceSq < ClosestDistanceSq)
-                {
-                    ClosestDistanceSq = DistanceSq;
-                    LocationName = Location.LocationName;
-                }
-            }
-            
-            // Only return the location if we're within a reasonable distance (500m)
-            if (ClosestDistanceSq > 500.0f * 500.0f)
-            {
-                LocationName.Empty();
+                LocationName = NearestLocation->LocationName;
             }
         }
     }
@@ -449,7 +1324,7 @@ FString UPhotographySystem::GetCurrentWeatherCondition()
     FString WeatherCondition = TEXT("Clear");
     
     // Get the world manager to check current weather
-    AWorldManager* WorldManager = Cast<AWorldManager>(UGameplayStatics::GetActorOfClass(GetWorld(), AWorldManager::StaticClass()));
+    AWorldManager* WorldManager = GetWorldManager();
     if (WorldManager)
     {
         // Convert enum to string
@@ -483,69 +1358,174 @@ FString UPhotographySystem::GetCurrentWeatherCondition()
     return WeatherCondition;
 }
 
-TArray<FString> UPhotographySystem::DetectVehiclesInFrame()
+void UPhotographySystem::DetectVehiclesInFrame(FPhotoMetadata&& Metadata)
 {
-    TArray<FString> DetectedVehicles;
-    APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+    FPendingVehicleDetection& Detection = PendingVehicleDetections.AddDefaulted_GetRef();
+    Detection.Metadata = MoveTemp(Metadata);
     
-    if (!PlayerController)
-        return DetectedVehicles;
+    APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+    UVehicleRegistrySubsystem* VehicleRegistry = GetWorld()->GetSubsystem<UVehicleRegistrySubsystem>();
     
-    // Get player camera
-    UCameraComponent* PlayerCamera = nullptr;
-    if (PlayerController->GetPawn())
+    if (PlayerController && PlayerController->PlayerCameraManager && VehicleRegistry)
     {
-        PlayerCamera = PlayerController->GetPawn()->FindComponentByClass<UCameraComponent>();
+        // Build the frustum from the view that's actually on screen
+        FMinimalViewInfo ViewInfo;
+        ViewInfo.Location = PlayerController->PlayerCameraManager->GetCameraLocation();
+        ViewInfo.Rotation = PlayerController->PlayerCameraManager->GetCameraRotation();
+        ViewInfo.FOV = PlayerController->PlayerCameraManager->GetFOVAngle();
+        
+        if (GEngine && GEngine->GameViewport)
+        {
+            FVector2D ViewportSize;
+            GEngine->GameViewport->GetViewportSize(ViewportSize);
+            if (ViewportSize.Y > 0.0f)
+            {
+                ViewInfo.AspectRatio = ViewportSize.X / ViewportSize.Y;
+            }
+        }
+        
+        FMatrix ViewMatrix;
+        FMatrix ProjectionMatrix;
+        FMatrix ViewProjectionMatrix;
+        UGameplayStatics::GetViewProjectionMatrix(ViewInfo, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+        
+        FConvexVolume ViewFrustum;
+        GetViewFrustumBounds(ViewFrustum, ViewProjectionMatrix, false);
+        
+        FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PhotoVehicleVisibility), false, PlayerController->GetPawn());
+        const float RangeSquared = VehicleDetectionRange * VehicleDetectionRange;
+        
+        for (ABaseVehicle* Vehicle : VehicleRegistry->GetVehicles())
+        {
+            if (!Vehicle || !Vehicle->GetRootComponent())
+                continue;
+            
+            const FVector VehicleLocation = Vehicle->GetActorLocation();
+            if (FVector::DistSquared(ViewInfo.Location, VehicleLocation) > RangeSquared)
+                continue;
+            
+            const FBoxSphereBounds& Bounds = Vehicle->GetRootComponent()->Bounds;
+            if (!ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent))
+                continue;
+            
+            // Check line of sight, the result arrives next frame
+            FTraceHandle TraceHandle = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, ViewInfo.Location, VehicleLocation,
+                                                                           ECC_Visibility, QueryParams, FCollisionResponseParams::DefaultResponseParam,
+                                                                           &VehicleTraceDelegate);
+            
+            Detection.TraceHandles.Add(TraceHandle);
+            Detection.Candidates.Add(Vehicle);
+        }
     }
     
-    if (!PlayerCamera)
-        return DetectedVehicles;
-    
-    // Get all vehicle actors
-    TArray<AActor*> Vehicles;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABaseVehicle::StaticClass(), Vehicles);
+    Detection.TracesRemaining = Detection.TraceHandles.Num();
     
-    // Check which ones are visible from the camera
-    for (AActor* Vehicle : Vehicles)
+    // Nothing in view, no need to wait
+    if (Detection.TracesRemaining == 0)
     {
-        ABaseVehicle* BaseVehicle = Cast<ABaseVehicle>(Vehicle);
-        if (!BaseVehicle)
-            continue;
-        
-        FVector CameraLocation = PlayerCamera->GetComponentLocation();
-        FRotator CameraRotation = PlayerCamera->GetComponentRotation();
-        
-        // Check if vehicle is in front of the camera
-        FVector DirectionToVehicle = Vehicle->GetActorLocation() - CameraLocation;
-        DirectionToVehicle.Normalize();
+        FPhotoMetadata CompletedMetadata = MoveTemp(Detection.Metadata);
+        PendingVehicleDetections.Pop();
+        CompletePhotoMetadata(CompletedMetadata);
+    }
+}
+
+void UPhotographySystem::OnVehicleTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceData)
+{
+    for (int32 DetectionIndex = 0; DetectionIndex < PendingVehicleDetections.Num(); ++DetectionIndex)
+    {
+        FPendingVehicleDetection& Detection = PendingVehicleDetections[DetectionIndex];
         
-        FVector CameraForward = CameraRotation.Vector();
+        const int32 CandidateIndex = Detection.TraceHandles.IndexOfByKey(TraceHandle);
+        if (CandidateIndex == INDEX_NONE)
+            continue;
         
-        float DotProduct = FVector::DotProduct(CameraForward, DirectionToVehicle);
+        // Visible if nothing blocks the line or the first thing hit is the vehicle itself
+        AActor* Vehicle = Detection.Candidates[CandidateIndex].Get();
+        const bool bBlocked = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit;
+        if (Vehicle && (!bBlocked || TraceData.OutHits[0].GetActor() == Vehicle))
+        {
+            Detection.Metadata.CapturedVehicles.Add(Vehicle->GetName());
+        }
         
-        // If dot product is positive, the vehicle is in front of the camera
-        if (DotProduct > 0.0f)
+        if (--Detection.TracesRemaining == 0)
         {
-            // Check if vehicle is within camera FOV
-            float AngleToDegrees = FMath::Acos(DotProduct) * 180.0f / PI;
-            
-            if (AngleToDegrees < PlayerCamera->FieldOfView * 0.5f)
-            {
-                // Check line of sight
-                FHitResult HitResult;
-                FCollisionQueryParams QueryParams;
-                QueryParams.AddIgnoredActor(PlayerController->GetPawn());
-                
-                if (!GetWorld()->LineTraceSingleByChannel(HitResult, CameraLocation, Vehicle->GetActorLocation(), 
-                                                         ECC_Visibility, QueryParams) ||
-                    HitResult.GetActor() == Vehicle)
-                {
-                    // Vehicle is visible, add its name
-                    DetectedVehicles.Add(Vehicle->GetName());
-                }
-            }
+            FPhotoMetadata CompletedMetadata = MoveTemp(Detection.Metadata);
+            PendingVehicleDetections.RemoveAt(DetectionIndex);
+            CompletePhotoMetadata(CompletedMetadata);
+        }
+        return;
+    }
+}
+
+void UPhotographySystem::CompletePhotoMetadata(FPhotoMetadata& Metadata)
+{
+    LastPhotoMetadata = Metadata;
+    
+    // The capture never started, there's nothing to catalog
+    if (Metadata.FilePath.IsEmpty())
+        return;
+    
+    bool bSaved = false;
+    if (SaveResultsAwaitingMetadata.RemoveAndCopyValue(Metadata.FilePath, bSaved))
+    {
+        if (bSaved)
+        {
+            CatalogPhoto(Metadata);
+        }
+    }
+    else
+    {
+        MetadataAwaitingSave.Add(Metadata.FilePath, MoveTemp(Metadata));
+    }
+}
+
+void UPhotographySystem::CatalogPhoto(const FPhotoMetadata& Metadata)
+{
+    UPhotoGallerySubsystem* Gallery = GetPhotoGallery();
+    if (Gallery)
+    {
+        Gallery->AddPhoto(Metadata);
+    }
+}
+
+AWorldManager* UPhotographySystem::GetWorldManager()
+{
+    if (!CachedWorldManager.IsValid())
+    {
+        UWorldServicesSubsystem* WorldServices = UWorldServicesSubsystem::Get(this);
+        if (WorldServices)
+        {
+            CachedWorldManager = WorldServices->GetWorldManager();
+        }
+    }
+    
+    return CachedWorldManager.Get();
+}
+
+UProgressionSystem* UPhotographySystem::GetProgressionSystem()
+{
+    if (!CachedProgressionSystem.IsValid())
+    {
+        UWorldServicesSubsystem* WorldServices = UWorldServicesSubsystem::Get(this);
+        if (WorldServices)
+        {
+            CachedProgressionSystem = WorldServices->GetProgressionSystem();
+        }
+    }
+    
+    return CachedProgressionSystem.Get();
+}
+
+UPhotoGallerySubsystem* UPhotographySystem::GetPhotoGallery()
+{
+    if (!CachedPhotoGallery.IsValid())
+    {
+        UWorldServicesSubsystem* WorldServices = UWorldServicesSubsystem::Get(this);
+        if (WorldServices)
+        {
+            CachedPhotoGallery = WorldServices->GetPhotoGallery();
         }
     }
     
-    return DetectedVehicles;
+    return CachedPhotoGallery.Get();
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "World/PointOfInterestGrid.h"
+
+FPointOfInterestGrid::FPointOfInterestGrid(float InCellSize)
+    : CellSize(FMath::Max(InCellSize, 1.0f))
+    , NumPoints(0)
+{
+}
+
+void FPointOfInterestGrid::Reset()
+{
+    Cells.Reset();
+    NumPoints = 0;
+}
+
+void FPointOfInterestGrid::Add(int32 Id, const FVector& Location)
+{
+    FEntry Entry;
+    Entry.Id = Id;
+    Entry.Location = Location;
+
+    Cells.FindOrAdd(GetCell(Location)).Add(Entry);
+    ++NumPoints;
+}
+
+int32 FPointOfInterestGrid::FindNearest(const FVector& Location, float MaxDistance, float* OutDistanceSquared) const
+{
+    int32 NearestId = INDEX_NONE;
+    float NearestDistanceSquared = MaxDistance * MaxDistance;
+
+    // Search rings of cells outwards, stopping once a ring can't hold anything closer
+    const FIntPoint CenterCell = GetCell(Location);
+    const int32 MaxRing = FMath::CeilToInt(MaxDistance / CellSize);
+
+    for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+    {
+        // Closest any point in this ring can be
+        const float RingDistance = FMath::Max(Ring - 1, 0) * CellSize;
+        if (NearestId != INDEX_NONE && RingDistance * RingDistance > NearestDistanceSquared)
+            break;
+
+        for (int32 CellY = CenterCell.Y - Ring; CellY <= CenterCell.Y + Ring; ++CellY)
+        {
+            // Interior rows only need the two edge cells
+            const bool bEdgeRow = CellY == CenterCell.Y - Ring || CellY == CenterCell.Y + Ring;
+            const int32 Step = (bEdgeRow || Ring == 0) ? 1 : Ring * 2;
+
+            for (int32 CellX = CenterCell.X - Ring; CellX <= CenterCell.X + Ring; CellX += Step)
+            {
+                const TArray<FEntry>* Entries = Cells.Find(FIntPoint(CellX, CellY));
+                if (!Entries)
+                    continue;
+
+                for (const FEntry& Entry : *Entries)
+                {
+                    const float DistanceSquared = FVector::DistSquared(Location, Entry.Location);
+                    if (DistanceSquared <= NearestDistanceSquared)
+                    {
+                        NearestDistanceSquared = DistanceSquared;
+                        NearestId = Entry.Id;
+                    }
+                }
+            }
+        }
+    }
+
+    if (OutDistanceSquared && NearestId != INDEX_NONE)
+    {
+        *OutDistanceSquared = NearestDistanceSquared;
+    }
+
+    return NearestId;
+}
\ No newline at end of file
@@ -1,48 +1,21 @@
 #include "World/ProgressionSystem.h"
+#include "World/ProgressionSaveGame.h"
+#include "OpenWorldExplorer.h"
 #include "Vehicles/BaseVehicle.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/SaveGame.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
 #include "Misc/FileHelper.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
-// SaveGame class for progression data
-UCLASS()
-class UProgressionSaveGame : public USaveGame
-{
-    GENERATED_BODY()
-    
-public:
-    UPROPERTY()
-    TArray<FDiscoveredLocation> DiscoveredLocations;
-    
-    UPROPERTY()
-    TArray<FVehicleUnlock> VehicleUnlocks;
-    
-    UPROPERTY()
-    TArray<FCustomizationUnlock> CustomizationUnlocks;
-    
-    UPROPERTY()
-    TArray<FAchievement> Achievements;
-    
-    UPROPERTY()
-    float TotalDistanceTraveled;
-    
-    UPROPERTY()
-    float DistanceTraveledByVehicle;
-    
-    UPROPERTY()
-    float DistanceTraveledOnFoot;
-    
-    UPROPERTY()
-    int32 TotalPhotosTaken;
-    
-    UPROPERTY()
-    int32 ExplorationPoints;
-    
-    UPROPERTY()
-    int32 ExplorationLevel;
-};
+DECLARE_CYCLE_STAT(TEXT("Progression Save Snapshot"), STAT_ProgressionSaveSnapshot, STATGROUP_OpenWorldExplorer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Progression Saves Written"), STAT_ProgressionSavesWritten, STATGROUP_OpenWorldExplorer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Progression Save Requests Merged"), STAT_ProgressionSaveRequestsMerged, STATGROUP_OpenWorldExplorer);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Progression Save Latency (ms)"), STAT_ProgressionSaveLatency, STATGROUP_OpenWorldExplorer);
+
+static const TCHAR* ProgressionSaveSlot = TEXT("ProgressionSave");
 
 UProgressionSystem::UProgressionSystem()
 {
@@ -53,13 +26,35 @@ UProgressionSystem::UProgressionSystem()
     ExplorationPoints = 0;
     ExplorationLevel = 1;
     
+    // Save scheduling - merge all save requests made within this window into one write
+    SaveDebounceSeconds = 2.0f;
+    bSaveDirty = false;
+    bSaveInFlight = false;
+    FirstDirtyTime = 0.0;
+    SaveDispatchTime = 0.0;
+    PendingSaveRequests = 0;
+    TotalMergedSaveRequests = 0;
+    LastSaveLatencyMs = 0.0f;
+    SaveSnapshot = nullptr;
+    NextPointUnlock = 0;
+    
     // Define level thresholds
     LevelThresholds = { 0, 1000, 2500, 5000, 10000, 15000, 25000, 40000, 60000, 100000 };
 }
 
 void UProgressionSystem::Tick(float DeltaTime)
 {
-    // Nothing to tick for now
+    if (bSaveInFlight && InFlightSave.IsReady())
+    {
+        OnAsyncSaveComplete(ProgressionSaveSlot, 0, InFlightSave.Get());
+    }
+    
+    // Flush merged save requests once the debounce window has elapsed.
+    // Real time is used so photo mode time dilation doesn't delay saves.
+    if (bSaveDirty && !bSaveInFlight && FPlatformTime::Seconds() - FirstDirtyTime >= SaveDebounceSeconds)
+    {
+        DispatchAsyncSave();
+    }
 }
 
 bool UProgressionSystem::IsTickable() const
@@ -81,39 +76,151 @@ void UProgressionSystem::Initialize()
         CreateDefaultAchievements();
         SetupDefaultVehicles();
         SetupDefaultCustomizations();
-        SaveProgressionData();
+        RebuildLookupIndices();
+        RebuildUnlockGraph();
+        RebuildAchievementCounters();
+        RequestSave();
     }
+    
+    // Catch up on anything the loaded or default state already qualifies for
+    CheckForUnlocks();
 }
 
 bool UProgressionSystem::SaveProgressionData()
 {
-    UProgressionSaveGame* SaveGameInstance = Cast<UProgressionSaveGame>(UGameplayStatics::CreateSaveGameObject(UProgressionSaveGame::StaticClass()));
-    if (SaveGameInstance)
+    // Write now instead of waiting for the debounce window
+    PendingSaveRequests++;
+    
+    if (bSaveInFlight)
+    {
+        // The in-flight snapshot is already stale, write again as soon as it completes
+        bSaveDirty = true;
+        FirstDirtyTime = 0.0;
+        return true;
+    }
+    
+    return DispatchAsyncSave();
+}
+
+void UProgressionSystem::FlushPendingSave()
+{
+    // Let the older async write land first, otherwise it could overwrite the slot after us with a stale snapshot
+    if (bSaveInFlight)
+    {
+        InFlightSave.Wait();
+        OnAsyncSaveComplete(ProgressionSaveSlot, 0, InFlightSave.Get());
+    }
+    
+    if (!bSaveDirty)
+    {
+        return;
+    }
+    
+    // Blocking write, used when the world is going away and async completion can't be waited on
+    UProgressionSaveGame* Snapshot = CreateSaveSnapshot();
+    if (Snapshot && UGameplayStatics::SaveGameToSlot(Snapshot, ProgressionSaveSlot, 0))
+    {
+        TotalMergedSaveRequests += FMath::Max(PendingSaveRequests - 1, 0);
+        bSaveDirty = false;
+        PendingSaveRequests = 0;
+    }
+}
+
+void UProgressionSystem::RequestSave()
+{
+    if (!bSaveDirty)
+    {
+        bSaveDirty = true;
+        FirstDirtyTime = FPlatformTime::Seconds();
+    }
+    
+    PendingSaveRequests++;
+}
+
+UProgressionSaveGame* UProgressionSystem::CreateSaveSnapshot()
+{
+    SCOPE_CYCLE_COUNTER(STAT_ProgressionSaveSnapshot);
+    
+    // Reuse one save object rather than creating a new one for every write
+    if (!SaveSnapshot)
+    {
+        SaveSnapshot = Cast<UProgressionSaveGame>(UGameplayStatics::CreateSaveGameObject(UProgressionSaveGame::StaticClass()));
+    }
+    
+    if (SaveSnapshot)
     {
         // Copy current data to save game
-        SaveGameInstance->DiscoveredLocations = DiscoveredLocations;
-        SaveGameInstance->VehicleUnlocks = VehicleUnlocks;
-        SaveGameInstance->CustomizationUnlocks = CustomizationUnlocks;
-        SaveGameInstance->Achievements = Achievements;
-        SaveGameInstance->TotalDistanceTraveled = TotalDistanceTraveled;
-        SaveGameInstance->DistanceTraveledByVehicle = DistanceTraveledByVehicle;
-        SaveGameInstance->DistanceTraveledOnFoot = DistanceTraveledOnFoot;
-        SaveGameInstance->TotalPhotosTaken = TotalPhotosTaken;
-        SaveGameInstance->ExplorationPoints = ExplorationPoints;
-        SaveGameInstance->ExplorationLevel = ExplorationLevel;
-        
-        // Save game to slot
-        return UGameplayStatics::SaveGameToSlot(SaveGameInstance, "ProgressionSave", 0);
+        SaveSnapshot->DiscoveredLocations = DiscoveredLocations;
+        SaveSnapshot->VehicleUnlocks = VehicleUnlocks;
+        SaveSnapshot->CustomizationUnlocks = CustomizationUnlocks;
+        SaveSnapshot->Achievements = Achievements;
+        FillAchievementProgress(SaveSnapshot->Achievements);
+        SaveSnapshot->TotalDistanceTraveled = TotalDistanceTraveled;
+        SaveSnapshot->DistanceTraveledByVehicle = DistanceTraveledByVehicle;
+        SaveSnapshot->DistanceTraveledOnFoot = DistanceTraveledOnFoot;
+        SaveSnapshot->TotalPhotosTaken = TotalPhotosTaken;
+        SaveSnapshot->ExplorationPoints = ExplorationPoints;
+        SaveSnapshot->ExplorationLevel = ExplorationLevel;
+        SaveSnapshot->SaveVersion = EProgressionSaveVersion::Latest;
     }
     
-    return false;
+    return SaveSnapshot;
+}
+
+bool UProgressionSystem::DispatchAsyncSave()
+{
+    // The snapshot is serialized here and the slot write happens on a worker thread
+    UProgressionSaveGame* Snapshot = CreateSaveSnapshot();
+    TArray<uint8> SaveData;
+    if (!Snapshot || !UGameplayStatics::SaveGameToMemory(Snapshot, SaveData))
+    {
+        return false;
+    }
+    
+    // Every request beyond the first was merged into this snapshot
+    const int32 MergedRequests = FMath::Max(PendingSaveRequests - 1, 0);
+    TotalMergedSaveRequests += MergedRequests;
+    INC_DWORD_STAT_BY(STAT_ProgressionSaveRequestsMerged, MergedRequests);
+    
+    bSaveDirty = false;
+    bSaveInFlight = true;
+    PendingSaveRequests = 0;
+    SaveDispatchTime = FPlatformTime::Seconds();
+    
+    // Completion is picked up in Tick, or waited on by FlushPendingSave
+    InFlightSave = Async(EAsyncExecution::TaskGraph, [SaveData = MoveTemp(SaveData)]()
+    {
+        return UGameplayStatics::SaveDataToSlot(SaveData, ProgressionSaveSlot, 0);
+    });
+    
+    return true;
+}
+
+void UProgressionSystem::OnAsyncSaveComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess)
+{
+    bSaveInFlight = false;
+    InFlightSave.Reset();
+    LastSaveLatencyMs = (float)((FPlatformTime::Seconds() - SaveDispatchTime) * 1000.0);
+    
+    INC_DWORD_STAT(STAT_ProgressionSavesWritten);
+    SET_FLOAT_STAT(STAT_ProgressionSaveLatency, LastSaveLatencyMs);
+    
+    UE_LOG(LogTemp, Verbose, TEXT("Progression saved to %s in %.2f ms (%d requests merged so far)"), *SlotName, LastSaveLatencyMs, TotalMergedSaveRequests);
+    
+    if (!bSuccess)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to save progression to slot %s"), *SlotName);
+        
+        // Try again after the next debounce window
+        RequestSave();
+    }
 }
 
 bool UProgressionSystem::LoadProgressionData()
 {
-    if (UGameplayStatics::DoesSaveGameExist("ProgressionSave", 0))
+    if (UGameplayStatics::DoesSaveGameExist(ProgressionSaveSlot, 0))
     {
-        UProgressionSaveGame* SaveGameInstance = Cast<UProgressionSaveGame>(UGameplayStatics::LoadGameFromSlot("ProgressionSave", 0));
+        UProgressionSaveGame* SaveGameInstance = Cast<UProgressionSaveGame>(UGameplayStatics::LoadGameFromSlot(ProgressionSaveSlot, 0));
         if (SaveGameInstance)
         {
             // Copy saved data to current state
@@ -128,6 +235,16 @@ bool UProgressionSystem::LoadProgressionData()
             ExplorationPoints = SaveGameInstance->ExplorationPoints;
             ExplorationLevel = SaveGameInstance->ExplorationLevel;
             
+            // Older saves only have the string achievement type
+            if (SaveGameInstance->SaveVersion < EProgressionSaveVersion::TypedAchievementCounters)
+            {
+                MigrateLegacyAchievementTypes();
+            }
+            
+            RebuildLookupIndices();
+            RebuildUnlockGraph();
+            RebuildAchievementCounters();
+            
             return true;
         }
     }
@@ -138,14 +255,12 @@ bool UProgressionSystem::LoadProgressionData()
 void UProgressionSystem::RegisterDiscoveredLocation(const FString& LocationName, const FVector& Coordinates)
 {
     // Check if this location has already been discovered
-    for (FDiscoveredLocation& Location : DiscoveredLocations)
+    const int32 ExistingIndex = FindDiscoveredLocationIndex(LocationName);
+    if (ExistingIndex != INDEX_NONE)
     {
-        if (Location.LocationName == LocationName)
-        {
-            // Already discovered, mark as visited
-            Location.bHasBeenVisited = true;
-            return;
-        }
+        // Already discovered, mark as visited
+        DiscoveredLocations[ExistingIndex].bHasBeenVisited = true;
+        return;
     }
     
     // New discovery
@@ -156,48 +271,51 @@ void UProgressionSystem::RegisterDiscoveredLocation(const FString& LocationName,
     NewLocation.bHasBeenPhotographed = false;
     NewLocation.DiscoveryTime = FDateTime::Now();
     
-    DiscoveredLocations.Add(NewLocation);
+    const int32 NewIndex = DiscoveredLocations.Add(NewLocation);
+    DiscoveredLocationIndex.Add(FName(*LocationName), NewIndex);
+    DiscoveredLocationGrid.Add(NewIndex, Coordinates);
+    
+    // Let vehicles waiting on this location know it has been found
+    NotifyLocationDiscovered(LocationName);
     
     // Award points for discovery
     AwardExplorationPoints(100);
     
     // Update achievements
-    UpdateAchievementProgress("Discoveries", DiscoveredLocations.Num());
+    UpdateAchievementProgress(EAchievementCounter::Discoveries, DiscoveredLocations.Num());
     
     // Check for unlocks based on new discovery
     CheckForUnlocks();
     
     // Save progress
-    SaveProgressionData();
+    RequestSave();
 }
 
 void UProgressionSystem::RegisterLocationPhotographed(const FString& LocationName)
 {
-    bool bFound = false;
-    
     // Find the location in the discovered locations
-    for (FDiscoveredLocation& Location : DiscoveredLocations)
+    const int32 LocationIndex = FindDiscoveredLocationIndex(LocationName);
+    const bool bFound = LocationIndex != INDEX_NONE;
+    
+    if (bFound)
     {
-        if (Location.LocationName == LocationName)
+        FDiscoveredLocation& Location = DiscoveredLocations[LocationIndex];
+        
+        // Check if it's already been photographed
+        if (!Location.bHasBeenPhotographed)
         {
-            // Check if it's already been photographed
-            if (!Location.bHasBeenPhotographed)
-            {
-                Location.bHasBeenPhotographed = true;
-                TotalPhotosTaken++;
-                
-                // Award points for photographing a location
-                AwardExplorationPoints(50);
-                
-                // Update achievement progress
-                UpdateAchievementProgress("Photos", TotalPhotosTaken);
-                
-                // Save progress
-                SaveProgressionData();
-            }
+            Location.bHasBeenPhotographed = true;
+            TotalPhotosTaken++;
             
-            bFound = true;
-            break;
+            // Award points for photographing a location
+            AwardExplorationPoints(50);
+            
+            // Update achievement progress
+            UpdateAchievementProgress(EAchievementCounter::Photos, TotalPhotosTaken);
+            UpdateAchievementProgress(EAchievementCounter::LocationPhotos, GetAchievementCounterValue(EAchievementCounter::LocationPhotos) + 1.0f);
+            
+            // Save progress
+            RequestSave();
         }
     }
     
@@ -205,8 +323,8 @@ void UProgressionSystem::RegisterLocationPhotographed(const FString& LocationNam
     if (!bFound)
     {
         TotalPhotosTaken++;
-        UpdateAchievementProgress("Photos", TotalPhotosTaken);
-        SaveProgressionData();
+        UpdateAchievementProgress(EAchievementCounter::Photos, TotalPhotosTaken);
+        RequestSave();
     }
 }
 
@@ -218,16 +336,16 @@ void UProgressionSystem::RegisterDistanceTraveled(float DistanceInMeters, bool b
     if (bInVehicle)
     {
         DistanceTraveledByVehicle += DistanceInMeters;
-        UpdateAchievementProgress("VehicleDistance", DistanceTraveledByVehicle);
+        UpdateAchievementProgress(EAchievementCounter::VehicleDistance, DistanceTraveledByVehicle);
     }
     else
     {
         DistanceTraveledOnFoot += DistanceInMeters;
-        UpdateAchievementProgress("FootDistance", DistanceTraveledOnFoot);
+        UpdateAchievementProgress(EAchievementCounter::FootDistance, DistanceTraveledOnFoot);
     }
     
     // Update total distance achievement
-    UpdateAchievementProgress("TotalDistance", TotalDistanceTraveled);
+    UpdateAchievementProgress(EAchievementCounter::TotalDistance, TotalDistanceTraveled);
     
     // Award exploration points (1 point per 10 meters)
     int32 PointsToAward = FMath::FloorToInt(DistanceInMeters / 10.0f);
@@ -239,18 +357,17 @@ void UProgressionSystem::RegisterDistanceTraveled(float DistanceInMeters, bool b
     // Save periodically (e.g., every 500 meters)
     if (FMath::Fmod(TotalDistanceTraveled, 500.0f) < DistanceInMeters)
     {
-        SaveProgressionData();
+        RequestSave();
     }
 }
 
 bool UProgressionSystem::IsVehicleUnlocked(const FString& VehicleName) const
 {
-    for (const FVehicleUnlock& Vehicle : VehicleUnlocks)
+    // FNAME_Find avoids adding unknown names to the name table
+    const int32* VehicleIndex = VehicleUnlockIndex.Find(FName(*VehicleName, FNAME_Find));
+    if (VehicleIndex)
     {
-        if (Vehicle.VehicleName == VehicleName)
-        {
-            return Vehicle.bIsUnlocked;
-        }
+        return VehicleUnlocks[*VehicleIndex].bIsUnlocked;
     }
     
     // Vehicle not found in list
@@ -279,14 +396,11 @@ TArray<FVehicleUnlock> UProgressionSystem::GetUnlockedVehicles() const
 
 bool UProgressionSystem::IsCustomizationUnlocked(const FString& Category, const FString& ItemType, const FString& ItemID) const
 {
-    for (const FCustomizationUnlock& Customization : CustomizationUnlocks)
+    const FCustomizationUnlockKey Key(FName(*Category, FNAME_Find), FName(*ItemType, FNAME_Find), FName(*ItemID, FNAME_Find));
+    const int32* CustomizationIndex = CustomizationUnlockIndex.Find(Key);
+    if (CustomizationIndex)
     {
-        if (Customization.Category == Category && 
-            Customization.ItemType == ItemType && 
-            Customization.ItemID == ItemID)
-        {
-            return Customization.bIsUnlocked;
-        }
+        return CustomizationUnlocks[*CustomizationIndex].bIsUnlocked;
     }
     
     // Item not found in list
@@ -362,7 +476,10 @@ int32 UProgressionSystem::GetPointsForNextLevel() const
 
 TArray<FAchievement> UProgressionSystem::GetAllAchievements() const
 {
-    return Achievements;
+    TArray<FAchievement> AllAchievements = Achievements;
+    FillAchievementProgress(AllAchievements);
+    
+    return AllAchievements;
 }
 
 TArray<FAchievement> UProgressionSystem::GetUnlockedAchievements() const
@@ -377,44 +494,196 @@ TArray<FAchievement> UProgressionSystem::GetUnlockedAchievements() const
         }
     }
     
+    FillAchievementProgress(UnlockedAchievements);
+    
     return UnlockedAchievements;
 }
 
-void UProgressionSystem::UpdateAchievementProgress(const FString& AchievementType, float Progress)
+void UProgressionSystem::UpdateAchievementProgress(EAchievementCounter Counter, float Progress)
 {
+    if (Counter == EAchievementCounter::None || Counter >= EAchievementCounter::MAX)
+    {
+        return;
+    }
+    
+    FAchievementCounterState& State = AchievementCounters[(int32)Counter];
+    State.Value = FMath::Max(State.Value, Progress);
+    
     bool bAchievementUnlocked = false;
     
-    // Update progress for all matching achievements
-    for (FAchievement& Achievement : Achievements)
+    // Achievements are sorted by target, so only the next pending threshold needs checking
+    while (State.AchievementsByTarget.IsValidIndex(State.NextPending))
     {
-        if (Achievement.AchievementType == AchievementType)
+        FAchievement& Achievement = Achievements[State.AchievementsByTarget[State.NextPending]];
+        
+        if (!Achievement.bIsUnlocked)
         {
-            // Update progress
-            Achievement.CurrentProgress = FMath::Max(Achievement.CurrentProgress, Progress);
-            
-            // Check if achievement is newly completed
-            if (!Achievement.bIsUnlocked && Achievement.CurrentProgress >= Achievement.TargetValue)
+            if (State.Value < Achievement.TargetValue)
             {
-                Achievement.bIsUnlocked = true;
-                bAchievementUnlocked = true;
-                
-                // Award points for completing achievement
-                AwardExplorationPoints(Achievement.RewardPoints);
+                break;
             }
+            
+            Achievement.bIsUnlocked = true;
+            bAchievementUnlocked = true;
+            
+            // Award points for completing achievement
+            AwardExplorationPoints(Achievement.RewardPoints);
         }
+        
+        State.NextPending++;
     }
     
     // Check for unlocks if an achievement was completed
     if (bAchievementUnlocked)
     {
         CheckForUnlocks();
-        SaveProgressionData();
+        RequestSave();
     }
     
     // Always check for new achievement progress
     CheckAchievements();
 }
 
+float UProgressionSystem::GetAchievementCounterValue(EAchievementCounter Counter) const
+{
+    if (Counter == EAchievementCounter::None || Counter >= EAchievementCounter::MAX)
+    {
+        return 0.0f;
+    }
+    
+    return AchievementCounters[(int32)Counter].Value;
+}
+
+void UProgressionSystem::RebuildAchievementCounters()
+{
+    for (FAchievementCounterState& State : AchievementCounters)
+    {
+        State = FAchievementCounterState();
+    }
+    
+    for (int32 i = 0; i < Achievements.Num(); ++i)
+    {
+        const FAchievement& Achievement = Achievements[i];
+        if (Achievement.Counter == EAchievementCounter::None || Achievement.Counter >= EAchievementCounter::MAX)
+        {
+            continue;
+        }
+        
+        // Restore the counter from the saved progress
+        FAchievementCounterState& State = AchievementCounters[(int32)Achievement.Counter];
+        State.AchievementsByTarget.Add(i);
+        State.Value = FMath::Max(State.Value, Achievement.CurrentProgress);
+    }
+    
+    // Counters backed by stored statistics start from those, which also covers migrated saves
+    int32 PhotographedLocations = 0;
+    for (const FDiscoveredLocation& Location : DiscoveredLocations)
+    {
+        PhotographedLocations += Location.bHasBeenPhotographed ? 1 : 0;
+    }
+    
+    auto SeedCounter = [this](EAchievementCounter Counter, float Value)
+    {
+        FAchievementCounterState& State = AchievementCounters[(int32)Counter];
+        State.Value = FMath::Max(State.Value, Value);
+    };
+    SeedCounter(EAchievementCounter::VehicleDistance, DistanceTraveledByVehicle);
+    SeedCounter(EAchievementCounter::FootDistance, DistanceTraveledOnFoot);
+    SeedCounter(EAchievementCounter::TotalDistance, TotalDistanceTraveled);
+    SeedCounter(EAchievementCounter::Discoveries, DiscoveredLocations.Num());
+    SeedCounter(EAchievementCounter::Photos, TotalPhotosTaken);
+    SeedCounter(EAchievementCounter::LocationPhotos, PhotographedLocations);
+    
+    for (FAchievementCounterState& State : AchievementCounters)
+    {
+        State.AchievementsByTarget.StableSort([this](int32 A, int32 B)
+        {
+            return Achievements[A].TargetValue < Achievements[B].TargetValue;
+        });
+        
+        // Skip past achievements that are already unlocked
+        while (State.AchievementsByTarget.IsValidIndex(State.NextPending) && Achievements[State.AchievementsByTarget[State.NextPending]].bIsUnlocked)
+        {
+            State.NextPending++;
+        }
+    }
+}
+
+void UProgressionSystem::FillAchievementProgress(TArray<FAchievement>& InOutAchievements) const
+{
+    // Progress lives in the counters, copy it out for callers and saves
+    for (FAchievement& Achievement : InOutAchievements)
+    {
+        Achievement.CurrentProgress = FMath::Max(Achievement.CurrentProgress, GetAchievementCounterValue(Achievement.Counter));
+    }
+}
+
+void UProgressionSystem::MigrateLegacyAchievementTypes()
+{
+    const UEnum* CounterEnum = StaticEnum<EAchievementCounter>();
+    
+    for (FAchievement& Achievement : Achievements)
+    {
+        // The legacy type strings match the counter names
+        const int64 CounterValue = CounterEnum->GetValueByNameString(Achievement.AchievementType);
+        Achievement.Counter = CounterValue != INDEX_NONE ? (EAchievementCounter)CounterValue : EAchievementCounter::None;
+        
+        if (Achievement.Counter == EAchievementCounter::None)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Achievement %s has unknown type %s"), *Achievement.AchievementName, *Achievement.AchievementType);
+        }
+    }
+}
+
+void UProgressionSystem::RebuildLookupIndices()
+{
+    DiscoveredLocationIndex.Reset();
+    DiscoveredLocationIndex.Reserve(DiscoveredLocations.Num());
+    DiscoveredLocationGrid.Reset();
+    for (int32 i = 0; i < DiscoveredLocations.Num(); ++i)
+    {
+        DiscoveredLocationIndex.Add(FName(*DiscoveredLocations[i].LocationName), i);
+        DiscoveredLocationGrid.Add(i, DiscoveredLocations[i].LocationCoordinates);
+    }
+    
+    VehicleUnlockIndex.Reset();
+    VehicleUnlockIndex.Reserve(VehicleUnlocks.Num());
+    for (int32 i = 0; i < VehicleUnlocks.Num(); ++i)
+    {
+        VehicleUnlockIndex.Add(FName(*VehicleUnlocks[i].VehicleName), i);
+    }
+    
+    CustomizationUnlockIndex.Reset();
+    CustomizationUnlockIndex.Reserve(CustomizationUnlocks.Num());
+    for (int32 i = 0; i < CustomizationUnlocks.Num(); ++i)
+    {
+        const FCustomizationUnlock& Customization = CustomizationUnlocks[i];
+        CustomizationUnlockIndex.Add(FCustomizationUnlockKey(FName(*Customization.Category), FName(*Customization.ItemType), FName(*Customization.ItemID)), i);
+    }
+}
+
+const FDiscoveredLocation* UProgressionSystem::FindNearestDiscoveredLocation(const FVector& Location, float MaxDistance) const
+{
+    const int32 LocationIndex = DiscoveredLocationGrid.FindNearest(Location, MaxDistance);
+    return LocationIndex != INDEX_NONE ? &DiscoveredLocations[LocationIndex] : nullptr;
+}
+
+bool UProgressionSystem::GetNearestDiscoveredLocation(const FVector& Location, float MaxDistance, FDiscoveredLocation& OutLocation) const
+{
+    const FDiscoveredLocation* Nearest = FindNearestDiscoveredLocation(Location, MaxDistance);
+    if (!Nearest)
+        return false;
+    
+    OutLocation = *Nearest;
+    return true;
+}
+
+int32 UProgressionSystem::FindDiscoveredLocationIndex(const FString& LocationName) const
+{
+    const int32* LocationIndex = DiscoveredLocationIndex.Find(FName(*LocationName, FNAME_Find));
+    return LocationIndex ? *LocationIndex : INDEX_NONE;
+}
+
 void UProgressionSystem::UpdateExplorationLevel()
 {
     // Find the level based on current points
@@ -435,7 +704,6 @@ void UProgressionSystem::UpdateExplorationLevel()
     if (NewLevel > ExplorationLevel)
     {
         ExplorationLevel = NewLevel;
-        CheckForUnlocks();
     }
 }
 
@@ -443,61 +711,122 @@ void UProgressionSystem::CheckForUnlocks()
 {
     bool bUnlocksMade = false;
     
-    // Check vehicle unlocks
-    for (FVehicleUnlock& Vehicle : VehicleUnlocks)
+    // Points only go up, so walk the points-ordered queue just as far as the current total reaches
+    while (PointUnlockQueue.IsValidIndex(NextPointUnlock) && ExplorationPoints >= PointUnlockQueue[NextPointUnlock].RequiredPoints)
     {
-        if (!Vehicle.bIsUnlocked && ExplorationPoints >= Vehicle.RequiredExplorationPoints)
+        const FPendingPointUnlock& Entry = PointUnlockQueue[NextPointUnlock++];
+        
+        if (Entry.bIsVehicle)
         {
-            // Check if all required discoveries have been made
-            bool bAllDiscoveriesFound = true;
-            for (const FString& RequiredDiscovery : Vehicle.RequiredDiscoveries)
+            // Vehicles still waiting on discoveries are unlocked by NotifyLocationDiscovered instead
+            FVehicleUnlock& Vehicle = VehicleUnlocks[Entry.Index];
+            if (!Vehicle.bIsUnlocked && VehicleMissingDiscoveries[Entry.Index] == 0)
             {
-                bool bFound = false;
-                for (const FDiscoveredLocation& Location : DiscoveredLocations)
-                {
-                    if (Location.LocationName == RequiredDiscovery)
-                    {
-                        bFound = true;
-                        break;
-                    }
-                }
-                
-                if (!bFound)
-                {
-                    bAllDiscoveriesFound = false;
-                    break;
-                }
+                Vehicle.bIsUnlocked = true;
+                bUnlocksMade = true;
             }
-            
-            if (bAllDiscoveriesFound)
+        }
+        else
+        {
+            FCustomizationUnlock& Customization = CustomizationUnlocks[Entry.Index];
+            if (!Customization.bIsUnlocked)
             {
-                Vehicle.bIsUnlocked = true;
+                Customization.bIsUnlocked = true;
                 bUnlocksMade = true;
             }
         }
     }
     
-    // Check customization unlocks
-    for (FCustomizationUnlock& Customization : CustomizationUnlocks)
+    // Save if any unlocks were made
+    if (bUnlocksMade)
+    {
+        RequestSave();
+    }
+}
+
+void UProgressionSystem::NotifyLocationDiscovered(const FString& LocationName)
+{
+    TArray<int32> WaitingVehicles;
+    if (!VehiclesWaitingOnLocation.RemoveAndCopyValue(FName(*LocationName, FNAME_Find), WaitingVehicles))
     {
-        if (!Customization.bIsUnlocked && ExplorationPoints >= Customization.RequiredExplorationPoints)
+        return;
+    }
+    
+    bool bUnlocksMade = false;
+    
+    // Only the vehicles that were waiting on this location are touched
+    for (int32 VehicleIndex : WaitingVehicles)
+    {
+        FVehicleUnlock& Vehicle = VehicleUnlocks[VehicleIndex];
+        if (--VehicleMissingDiscoveries[VehicleIndex] == 0 && !Vehicle.bIsUnlocked && ExplorationPoints >= Vehicle.RequiredExplorationPoints)
         {
-            Customization.bIsUnlocked = true;
+            Vehicle.bIsUnlocked = true;
             bUnlocksMade = true;
         }
     }
     
-    // Save if any unlocks were made
     if (bUnlocksMade)
     {
-        SaveProgressionData();
+        RequestSave();
     }
 }
 
+void UProgressionSystem::RebuildUnlockGraph()
+{
+    PointUnlockQueue.Reset();
+    VehiclesWaitingOnLocation.Reset();
+    VehicleMissingDiscoveries.Init(0, VehicleUnlocks.Num());
+    NextPointUnlock = 0;
+    
+    for (int32 i = 0; i < VehicleUnlocks.Num(); ++i)
+    {
+        const FVehicleUnlock& Vehicle = VehicleUnlocks[i];
+        if (Vehicle.bIsUnlocked)
+        {
+            continue;
+        }
+        
+        // Register the vehicle with each distinct location it still needs
+        TSet<FName, DefaultKeyFuncs<FName>, TInlineSetAllocator<8>> MissingLocations;
+        for (const FString& RequiredDiscovery : Vehicle.RequiredDiscoveries)
+        {
+            if (FindDiscoveredLocationIndex(RequiredDiscovery) == INDEX_NONE)
+            {
+                MissingLocations.Add(FName(*RequiredDiscovery));
+            }
+        }
+        
+        for (const FName& LocationName : MissingLocations)
+        {
+            VehiclesWaitingOnLocation.FindOrAdd(LocationName).Add(i);
+        }
+        
+        VehicleMissingDiscoveries[i] = MissingLocations.Num();
+        PointUnlockQueue.Add({ Vehicle.RequiredExplorationPoints, true, i });
+    }
+    
+    for (int32 i = 0; i < CustomizationUnlocks.Num(); ++i)
+    {
+        if (!CustomizationUnlocks[i].bIsUnlocked)
+        {
+            PointUnlockQueue.Add({ CustomizationUnlocks[i].RequiredExplorationPoints, false, i });
+        }
+    }
+    
+    // Stable so entries with equal requirements keep their authored order
+    PointUnlockQueue.StableSort([](const FPendingPointUnlock& A, const FPendingPointUnlock& B)
+    {
+        return A.RequiredPoints < B.RequiredPoints;
+    });
+}
+
 void UProgressionSystem::AwardExplorationPoints(int32 Points)
 {
     ExplorationPoints += Points;
     UpdateExplorationLevel();
+    
+    // Cheap now that only the next pending threshold is compared
+    CheckForUnlocks();
 }
 
 void UProgressionSystem::CheckAchievements()
@@ -510,20 +839,20 @@ void UProgressionSystem::CreateDefaultAchievements()
     Achievements.Empty();
     
     // Distance-based achievements
-    Achievements.Add(CreateAchievement("Road Tripper", "Travel 10 km in vehicles", "VehicleDistance", 10000.0f, 250));
-    Achievements.Add(CreateAchievement("Off the Beaten Path", "Travel 5 km on foot", "FootDistance", 5000.0f, 200));
-    Achievements.Add(CreateAchievement("Globetrotter", "Travel a total of 50 km", "TotalDistance", 50000.0f, 500));
-    Achievements.Add(CreateAchievement("World Explorer", "Travel a total of 100 km", "TotalDistance", 100000.0f, 1000));
+    Achievements.Add(CreateAchievement("Road Tripper", "Travel 10 km in vehicles", EAchievementCounter::VehicleDistance, 10000.0f, 250));
+    Achievements.Add(CreateAchievement("Off the Beaten Path", "Travel 5 km on foot", EAchievementCounter::FootDistance, 5000.0f, 200));
+    Achievements.Add(CreateAchievement("Globetrotter", "Travel a total of 50 km", EAchievementCounter::TotalDistance, 50000.0f, 500));
+    Achievements.Add(CreateAchievement("World Explorer", "Travel a total of 100 km", EAchievementCounter::TotalDistance, 100000.0f, 1000));
     
     // Discovery-based achievements
-    Achievements.Add(CreateAchievement("Sightseer", "Discover 5 locations", "Discoveries", 5.0f, 150));
-    Achievements.Add(CreateAchievement("Explorer", "Discover 15 locations", "Discoveries", 15.0f, 300));
-    Achievements.Add(CreateAchievement("Cartographer", "Discover all locations", "Discoveries", 30.0f, 1000));
+    Achievements.Add(CreateAchievement("Sightseer", "Discover 5 locations", EAchievementCounter::Discoveries, 5.0f, 150));
+    Achievements.Add(CreateAchievement("Explorer", "Discover 15 locations", EAchievementCounter::Discoveries, 15.0f, 300));
+    Achievements.Add(CreateAchievement("Cartographer", "Discover all locations", EAchievementCounter::Discoveries, 30.0f, 1000));
     
     // Photography-based achievements
-    Achievements.Add(CreateAchievement("Shutterbug", "Take 10 photographs", "Photos", 10.0f, 100));
-    Achievements.Add(CreateAchievement("Photographer", "Take 25 photographs", "Photos", 25.0f, 250));
-    Achievements.Add(CreateAchievement("Photojournalist", "Photograph 15 different locations", "LocationPhotos", 15.0f, 300));
+    Achievements.Add(CreateAchievement("Shutterbug", "Take 10 photographs", EAchievementCounter::Photos, 10.0f, 100));
+    Achievements.Add(CreateAchievement("Photographer", "Take 25 photographs", EAchievementCounter::Photos, 25.0f, 250));
+    Achievements.Add(CreateAchievement("Photojournalist", "Photograph 15 different locations", EAchievementCounter::LocationPhotos, 15.0f, 300));
 }
 
 void UProgressionSystem::SetupDefaultVehicles()
@@ -592,12 +921,12 @@ void UProgressionSystem::SetupDefaultCustomizations()
     }
 }
 
-FAchievement UProgressionSystem::CreateAchievement(const FString& Name, const FString& Description, const FString& Type, float Target, int32 Reward)
+FAchievement UProgressionSystem::CreateAchievement(const FString& Name, const FString& Description, EAchievementCounter Counter, float Target, int32 Reward)
 {
     FAchievement Achievement;
     Achievement.AchievementName = Name;
     Achievement.Description = Description;
-    Achievement.AchievementType = Type;
+    Achievement.Counter = Counter;
     Achievement.TargetValue = Target;
     Achievement.RewardPoints = Reward;
     Achievement.CurrentProgress = 0.0f;
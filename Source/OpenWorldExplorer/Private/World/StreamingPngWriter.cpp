@@ -0,0 +1,202 @@
+#include "World/StreamingPngWriter.h"
+#include "HAL/PlatformFilemanager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+struct FStreamingPngWriter::FDeflateStream
+{
+    z_stream Stream;
+    bool bInitialized = false;
+
+    FDeflateStream()
+    {
+        FMemory::Memzero(Stream);
+    }
+
+    ~FDeflateStream()
+    {
+        if (bInitialized)
+        {
+            deflateEnd(&Stream);
+        }
+    }
+};
+
+// Compressed bytes per IDAT chunk
+static const int32 PngChunkSize = 64 * 1024;
+
+static void WriteBigEndian(uint8* Dest, uint32 Value)
+{
+    Dest[0] = (Value >> 24) & 0xFF;
+    Dest[1] = (Value >> 16) & 0xFF;
+    Dest[2] = (Value >> 8) & 0xFF;
+    Dest[3] = Value & 0xFF;
+}
+
+FStreamingPngWriter::FStreamingPngWriter()
+    : Deflater(MakeUnique<FDeflateStream>())
+    , bFailed(false)
+    , Width(0)
+    , Height(0)
+    , RowsWritten(0)
+{
+}
+
+FStreamingPngWriter::~FStreamingPngWriter() = default;
+
+bool FStreamingPngWriter::Open(const FString& FilePath, int32 InWidth, int32 InHeight, int32 CompressionLevel)
+{
+    check(!IsOpen());
+
+    if (InWidth <= 0 || InHeight <= 0)
+        return false;
+
+    FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath));
+    if (!FileHandle)
+        return false;
+
+    Width = InWidth;
+    Height = InHeight;
+    RowsWritten = 0;
+    bFailed = false;
+
+    // Filter type byte followed by RGB
+    RowBuffer.SetNumUninitialized(1 + Width * 3);
+    OutputBuffer.SetNumUninitialized(PngChunkSize);
+
+    z_stream& Stream = Deflater->Stream;
+    FMemory::Memzero(Stream);
+    if (deflateInit(&Stream, FMath::Clamp(CompressionLevel, 0, 9)) != Z_OK)
+    {
+        FileHandle.Reset();
+        return false;
+    }
+    Deflater->bInitialized = true;
+    Stream.next_out = OutputBuffer.GetData();
+    Stream.avail_out = OutputBuffer.Num();
+
+    static const uint8 Signature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    bFailed |= !FileHandle->Write(Signature, sizeof(Signature));
+
+    // 8 bits per channel, truecolor, default compression, filtering and no interlace
+    uint8 Header[13] = {};
+    WriteBigEndian(Header, Width);
+    WriteBigEndian(Header + 4, Height);
+    Header[8] = 8;
+    Header[9] = 2;
+    bFailed |= !WriteChunk("IHDR", Header, sizeof(Header));
+
+    return !bFailed;
+}
+
+bool FStreamingPngWriter::WriteRows(const FColor* Pixels, int32 NumRows)
+{
+    if (!IsOpen() || bFailed || RowsWritten + NumRows > Height)
+        return false;
+
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        const FColor* Source = Pixels + Row * Width;
+        uint8* Dest = RowBuffer.GetData();
+
+        // Sub filter, each byte stored as the difference to the pixel on its left
+        *Dest++ = 1;
+        FColor Left(0, 0, 0);
+        for (int32 X = 0; X < Width; ++X)
+        {
+            const FColor& Pixel = Source[X];
+            *Dest++ = (uint8)(Pixel.R - Left.R);
+            *Dest++ = (uint8)(Pixel.G - Left.G);
+            *Dest++ = (uint8)(Pixel.B - Left.B);
+            Left = Pixel;
+        }
+
+        Deflater->Stream.next_in = RowBuffer.GetData();
+        Deflater->Stream.avail_in = RowBuffer.Num();
+        if (!Deflate(Z_NO_FLUSH))
+            return false;
+    }
+
+    RowsWritten += NumRows;
+    return true;
+}
+
+bool FStreamingPngWriter::Close()
+{
+    if (!IsOpen())
+        return false;
+
+    bool bSuccess = !bFailed && RowsWritten == Height;
+    if (bSuccess)
+    {
+        Deflater->Stream.next_in = nullptr;
+        Deflater->Stream.avail_in = 0;
+        bSuccess = Deflate(Z_FINISH) && WriteChunk("IEND", nullptr, 0);
+    }
+
+    deflateEnd(&Deflater->Stream);
+    Deflater->bInitialized = false;
+
+    bSuccess &= FileHandle->Flush();
+    FileHandle.Reset();
+    RowBuffer.Empty();
+    OutputBuffer.Empty();
+
+    return bSuccess;
+}
+
+bool FStreamingPngWriter::WriteChunk(const char* Type, const uint8* Data, int32 Size)
+{
+    uint8 Length[4];
+    WriteBigEndian(Length, Size);
+
+    // The CRC covers the chunk type and its data
+    uLong Crc = crc32(0L, reinterpret_cast<const Bytef*>(Type), 4);
+    if (Size > 0)
+    {
+        Crc = crc32(Crc, Data, Size);
+    }
+    uint8 CrcBytes[4];
+    WriteBigEndian(CrcBytes, Crc);
+
+    return FileHandle->Write(Length, 4)
+        && FileHandle->Write(reinterpret_cast<const uint8*>(Type), 4)
+        && (Size == 0 || FileHandle->Write(Data, Size))
+        && FileHandle->Write(CrcBytes, 4);
+}
+
+bool FStreamingPngWriter::Deflate(int32 Flush)
+{
+    z_stream& Stream = Deflater->Stream;
+    for (;;)
+    {
+        const int32 Result = deflate(&Stream, Flush);
+        if (Result == Z_STREAM_ERROR)
+        {
+            bFailed = true;
+            return false;
+        }
+
+        const bool bOutputFull = Stream.avail_out == 0;
+        const bool bFinished = Result == Z_STREAM_END;
+
+        // Only full chunks go out mid-stream, whatever is left goes with the last one
+        if (bOutputFull || bFinished)
+        {
+            const int32 Pending = OutputBuffer.Num() - Stream.avail_out;
+            if (Pending > 0 && !WriteChunk("IDAT", OutputBuffer.GetData(), Pending))
+            {
+                bFailed = true;
+                return false;
+            }
+            Stream.next_out = OutputBuffer.GetData();
+            Stream.avail_out = OutputBuffer.Num();
+        }
+
+        if (bFinished || (Flush == Z_NO_FLUSH && Stream.avail_in == 0 && !bOutputFull))
+            return true;
+    }
+}
\ No newline at end of file
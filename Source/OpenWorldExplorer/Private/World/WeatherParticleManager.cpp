@@ -0,0 +1,213 @@
+#include "World/WeatherParticleManager.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Camera/CameraComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "OpenWorldExplorer.h"
+
+// HTML5 builds run in a 1024 MB heap, weather gets a small fixed slice of it
+static TAutoConsoleVariable<int32> CVarWeatherParticleBudgetKB(
+    TEXT("ow.Weather.ParticleBudgetKB"),
+    8192,
+    TEXT("Memory budget for weather particles in kilobytes.\n")
+    TEXT("Spawn rates are scaled down when the active effects would need more."),
+    ECVF_Scalability);
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Weather Particle Memory (KB)"), STAT_WeatherParticleMemoryKB, STATGROUP_OpenWorldExplorer);
+
+UWeatherParticleManager::UWeatherParticleManager()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+
+    // Default values
+    BytesPerParticle = 256;
+    EstimatedMemoryKB = 0.0f;
+
+    Lightning.Offset = FVector(0.0f, 0.0f, 2000.0f);
+    Lightning.MaxSpawnRate = 2.0f;
+    Lightning.MaxActiveParticles = 16;
+    Lightning.CullDistance = 20000.0f;
+
+    Fog.Offset = FVector::ZeroVector;
+    Fog.MaxSpawnRate = 50.0f;
+    Fog.MaxActiveParticles = 200;
+    Fog.CullDistance = 5000.0f;
+
+    Snow.MaxSpawnRate = 600.0f;
+    Snow.MaxActiveParticles = 3000;
+
+    for (int32 i = 0; i < NumEffects; ++i)
+    {
+        Intensities[i] = 0.0f;
+        AppliedSpawnRates[i] = 0.0f;
+    }
+}
+
+void UWeatherParticleManager::BeginPlay()
+{
+    Super::BeginPlay();
+
+    PrewarmEmitters();
+}
+
+void UWeatherParticleManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Emitters may be attached to another actor, so clean them up explicitly
+    for (UParticleSystemComponent* Emitter : Emitters)
+    {
+        if (Emitter)
+        {
+            Emitter->DestroyComponent();
+        }
+    }
+    Emitters.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UWeatherParticleManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    // Follow the player from character to vehicle and back
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    if (PlayerPawn && PlayerPawn != AttachedPawn.Get())
+    {
+        AttachToPawn(PlayerPawn);
+    }
+}
+
+void UWeatherParticleManager::SetEffectIntensities(float InRain, float InLightning, float InFog, float InSnow)
+{
+    Intensities[0] = FMath::Clamp(InRain, 0.0f, 1.0f);
+    Intensities[1] = FMath::Clamp(InLightning, 0.0f, 1.0f);
+    Intensities[2] = FMath::Clamp(InFog, 0.0f, 1.0f);
+    Intensities[3] = FMath::Clamp(InSnow, 0.0f, 1.0f);
+
+    ApplyIntensities();
+}
+
+const FWeatherEmitterSettings& UWeatherParticleManager::GetSettings(int32 Effect) const
+{
+    switch (Effect)
+    {
+        case 0: return Rain;
+        case 1: return Lightning;
+        case 2: return Fog;
+        default: return Snow;
+    }
+}
+
+void UWeatherParticleManager::PrewarmEmitters()
+{
+    Emitters.Init(nullptr, NumEffects);
+
+    for (int32 i = 0; i < NumEffects; ++i)
+    {
+        const FWeatherEmitterSettings& Settings = GetSettings(i);
+        if (!Settings.Template)
+            continue;
+
+        UParticleSystemComponent* Emitter = NewObject<UParticleSystemComponent>(GetOwner());
+        Emitter->bAutoActivate = false;
+        Emitter->bAutoDestroy = false;
+        Emitter->SetTemplate(Settings.Template);
+
+        // Keep falling particles vertical while the camera turns
+        Emitter->SetUsingAbsoluteRotation(true);
+        Emitter->RegisterComponent();
+
+        Emitter->SetFloatParameter(TEXT("CullDistance"), Settings.CullDistance);
+        Emitter->SetFloatParameter(TEXT("SpawnRate"), 0.0f);
+
+        // Activate once so the emitter instances are allocated now rather than on the first weather change
+        Emitter->ActivateSystem(true);
+        Emitter->DeactivateSystem();
+
+        Emitters[i] = Emitter;
+    }
+
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    if (PlayerPawn)
+    {
+        AttachToPawn(PlayerPawn);
+    }
+
+    ApplyIntensities();
+}
+
+void UWeatherParticleManager::AttachToPawn(APawn* Pawn)
+{
+    AttachedPawn = Pawn;
+
+    // Prefer the camera so effects surround what the player sees
+    USceneComponent* AttachParent = Pawn->FindComponentByClass<UCameraComponent>();
+    if (!AttachParent)
+    {
+        AttachParent = Pawn->GetRootComponent();
+    }
+
+    for (int32 i = 0; i < NumEffects; ++i)
+    {
+        UParticleSystemComponent* Emitter = Emitters[i];
+        if (!Emitter)
+            continue;
+
+        Emitter->AttachToComponent(AttachParent, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+        Emitter->SetRelativeLocation(GetSettings(i).Offset);
+    }
+}
+
+void UWeatherParticleManager::ApplyIntensities()
+{
+    // Particles the requested intensities would keep alive
+    float DemandedParticles = 0.0f;
+    for (int32 i = 0; i < NumEffects; ++i)
+    {
+        if (Emitters.IsValidIndex(i) && Emitters[i])
+        {
+            DemandedParticles += Intensities[i] * GetSettings(i).MaxActiveParticles;
+        }
+    }
+
+    // Scale every effect down evenly if that doesn't fit the budget
+    const float BudgetParticles = CVarWeatherParticleBudgetKB.GetValueOnGameThread() * 1024.0f / FMath::Max(BytesPerParticle, 1);
+    const float BudgetScale = DemandedParticles > BudgetParticles ? BudgetParticles / DemandedParticles : 1.0f;
+
+    for (int32 i = 0; i < NumEffects; ++i)
+    {
+        UParticleSystemComponent* Emitter = Emitters.IsValidIndex(i) ? Emitters[i] : nullptr;
+        if (!Emitter)
+            continue;
+
+        const float SpawnRate = Intensities[i] * GetSettings(i).MaxSpawnRate * BudgetScale;
+
+        if (SpawnRate <= KINDA_SMALL_NUMBER)
+        {
+            if (Emitter->IsActive())
+            {
+                Emitter->DeactivateSystem();
+            }
+            AppliedSpawnRates[i] = 0.0f;
+            continue;
+        }
+
+        // Weather transitions call this every frame, skip changes too small to see
+        if (!FMath::IsNearlyEqual(SpawnRate, AppliedSpawnRates[i], FMath::Max(AppliedSpawnRates[i] * 0.02f, 0.1f)))
+        {
+            Emitter->SetFloatParameter(TEXT("SpawnRate"), SpawnRate);
+            Emitter->SetFloatParameter(TEXT("Intensity"), Intensities[i]);
+            AppliedSpawnRates[i] = SpawnRate;
+        }
+
+        if (!Emitter->IsActive())
+        {
+            Emitter->ActivateSystem(false);
+        }
+    }
+
+    EstimatedMemoryKB = FMath::Min(DemandedParticles, BudgetParticles) * BytesPerParticle / 1024.0f;
+    SET_FLOAT_STAT(STAT_WeatherParticleMemoryKB, EstimatedMemoryKB);
+}
\ No newline at end of file
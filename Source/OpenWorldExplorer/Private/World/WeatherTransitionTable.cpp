@@ -0,0 +1,33 @@
+#include "World/WeatherTransitionTable.h"
+
+bool UWeatherTransitionTable::PickNextWeather(EWeatherType From, float Roll, EWeatherType& OutWeather) const
+{
+    const FWeatherTransitionRow* Row = Transitions.Find(From);
+    if (!Row)
+        return false;
+
+    float TotalWeight = 0.0f;
+    for (const TPair<EWeatherType, float>& Entry : Row->NextWeatherWeights)
+    {
+        TotalWeight += FMath::Max(Entry.Value, 0.0f);
+    }
+
+    if (TotalWeight <= 0.0f)
+        return false;
+
+    // Walk the weights in map order, which is stable for a loaded asset
+    float Remaining = Roll * TotalWeight;
+    for (const TPair<EWeatherType, float>& Entry : Row->NextWeatherWeights)
+    {
+        const float Weight = FMath::Max(Entry.Value, 0.0f);
+        if (Weight > 0.0f)
+        {
+            OutWeather = Entry.Key;
+            if (Remaining < Weight)
+                break;
+            Remaining -= Weight;
+        }
+    }
+
+    return true;
+}
\ No newline at end of file
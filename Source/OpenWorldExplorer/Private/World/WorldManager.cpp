@@ -9,6 +9,46 @@
 #include "TimerManager.h"
 #include "Engine/DirectionalLight.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "OpenWorldExplorer.h"
+#include "World/DayCycleProfile.h"
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveLinearColor.h"
+#include "World/WeatherParticleManager.h"
+#include "World/WeatherTransitionTable.h"
+#include "World/WorldServicesSubsystem.h"
+
+FWeatherPreset FWeatherPreset::Blend(const FWeatherPreset& A, const FWeatherPreset& B, float Alpha)
+{
+    FWeatherPreset Result;
+    Result.CloudBottomAltitude = FMath::Lerp(A.CloudBottomAltitude, B.CloudBottomAltitude, Alpha);
+    Result.CloudLayerHeight = FMath::Lerp(A.CloudLayerHeight, B.CloudLayerHeight, Alpha);
+    Result.CloudSettings = FMath::Lerp(A.CloudSettings, B.CloudSettings, Alpha);
+    Result.ColorSaturation = FMath::Lerp(A.ColorSaturation, B.ColorSaturation, Alpha);
+    Result.ColorContrast = FMath::Lerp(A.ColorContrast, B.ColorContrast, Alpha);
+    Result.ColorGain = FMath::Lerp(A.ColorGain, B.ColorGain, Alpha);
+    Result.DepthOfFieldAmount = FMath::Lerp(A.DepthOfFieldAmount, B.DepthOfFieldAmount, Alpha);
+    Result.DepthOfFieldFocalDistance = FMath::Lerp(A.DepthOfFieldFocalDistance, B.DepthOfFieldFocalDistance, Alpha);
+    Result.DepthOfFieldFstop = FMath::Lerp(A.DepthOfFieldFstop, B.DepthOfFieldFstop, Alpha);
+    Result.RainIntensity = FMath::Lerp(A.RainIntensity, B.RainIntensity, Alpha);
+    Result.LightningIntensity = FMath::Lerp(A.LightningIntensity, B.LightningIntensity, Alpha);
+    Result.FogIntensity = FMath::Lerp(A.FogIntensity, B.FogIntensity, Alpha);
+    Result.SnowIntensity = FMath::Lerp(A.SnowIntensity, B.SnowIntensity, Alpha);
+    return Result;
+}
+
+static TAutoConsoleVariable<float> CVarSkyRecaptureBudget(
+    TEXT("ow.Sky.RecaptureBudget"),
+    6.0f,
+    TEXT("Maximum sky light recaptures per minute from time of day and weather changes.\n")
+    TEXT("Changes are held until the budget allows the next capture. 0 = only forced captures."),
+    ECVF_Scalability);
+
+// Schedule steps searched ahead for forecasts
+static const int32 MaxWeatherForecastSteps = 4096;
+
+DECLARE_CYCLE_STAT(TEXT("Weather Update"), STAT_WeatherUpdate, STATGROUP_OpenWorldExplorer);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sky Recaptures Per Minute"), STAT_SkyRecapturesPerMinute, STATGROUP_OpenWorldExplorer);
 
 AWorldManager::AWorldManager()
 {
@@ -30,21 +70,112 @@ AWorldManager::AWorldManager()
     WeatherPostProcess = CreateDefaultSubobject<UPostProcessComponent>(TEXT("WeatherPostProcess"));
     WeatherPostProcess->SetupAttachment(RootComponent);
     
+    WeatherParticles = CreateDefaultSubobject<UWeatherParticleManager>(TEXT("WeatherParticles"));
+    
     // Default settings
     TimeOfDay = 12.0f; // Start at noon
     TimeScale = 1.0f;  // 1 minute in real time = 1 hour in game
     bUseRealTime = false;
     CurrentWeather = EWeatherType::Clear;
     WeatherChangeProbability = 0.05f; // 5% chance per minute
+    
+    // Weather schedule
+    WeatherTransitions = nullptr;
+    WeatherSeed = 0;
+    WeatherStepSeconds = 10.0f;
+    WeatherPrestreamLeadTime = 20.0f;
+    WeatherStepAccumulator = 0.0f;
+    UpcomingWeather = EWeatherType::Clear;
+    StepsUntilWeatherChange = INDEX_NONE;
+    bUpcomingWeatherAnnounced = false;
+    
+    DayCycleProfile = nullptr;
+    
+    // Weather presets
+    WeatherTransitionDuration = 30.0f;
+    WeatherTransitionAlpha = 1.0f;
+    bWeatherTransitioning = false;
+    
+    FWeatherPreset ClearPreset; // Low density and coverage
+    WeatherPresets.Add(EWeatherType::Clear, ClearPreset);
+    
+    FWeatherPreset CloudyPreset; // Medium density, high coverage
+    CloudyPreset.CloudBottomAltitude = 4000.0f;
+    CloudyPreset.CloudLayerHeight = 3000.0f;
+    CloudyPreset.CloudSettings = FVector(0.7f, 0.6f, 0.5f);
+    WeatherPresets.Add(EWeatherType::Cloudy, CloudyPreset);
+    
+    FWeatherPreset RainPreset; // High density and coverage, slightly desaturated
+    RainPreset.CloudBottomAltitude = 2000.0f;
+    RainPreset.CloudLayerHeight = 4000.0f;
+    RainPreset.CloudSettings = FVector(0.8f, 0.8f, 0.7f);
+    RainPreset.ColorSaturation = FVector4(0.8f, 0.8f, 0.8f, 1.0f);
+    RainPreset.RainIntensity = 1.0f;
+    WeatherPresets.Add(EWeatherType::Rain, RainPreset);
+    
+    FWeatherPreset StormPreset; // Very high density and coverage, darker with more contrast
+    StormPreset.CloudBottomAltitude = 1000.0f;
+    StormPreset.CloudLayerHeight = 5000.0f;
+    StormPreset.CloudSettings = FVector(0.9f, 0.9f, 0.8f);
+    StormPreset.ColorContrast = FVector4(1.2f, 1.2f, 1.2f, 1.0f);
+    StormPreset.ColorSaturation = FVector4(0.7f, 0.7f, 0.7f, 1.0f);
+    StormPreset.RainIntensity = 1.0f;
+    StormPreset.LightningIntensity = 1.0f;
+    WeatherPresets.Add(EWeatherType::Storm, StormPreset);
+    
+    FWeatherPreset FogPreset; // Low density, medium coverage, blur for distance
+    FogPreset.CloudBottomAltitude = 0.0f;
+    FogPreset.CloudLayerHeight = 2000.0f;
+    FogPreset.CloudSettings = FVector(0.2f, 0.3f, 0.5f);
+    FogPreset.DepthOfFieldAmount = 1.0f;
+    FogPreset.DepthOfFieldFocalDistance = 5000.0f;
+    FogPreset.DepthOfFieldFstop = 2.0f;
+    FogPreset.FogIntensity = 1.0f;
+    WeatherPresets.Add(EWeatherType::Fog, FogPreset);
+    
+    FWeatherPreset SnowPreset; // High density, medium coverage, bright with a slight blue tint
+    SnowPreset.CloudBottomAltitude = 3000.0f;
+    SnowPreset.CloudLayerHeight = 3000.0f;
+    SnowPreset.CloudSettings = FVector(0.8f, 0.7f, 0.6f);
+    SnowPreset.ColorGain = FVector4(0.9f, 0.95f, 1.1f, 1.0f);
+    SnowPreset.SnowIntensity = 1.0f;
+    WeatherPresets.Add(EWeatherType::Snow, SnowPreset);
+    
+    // Sky recapture thresholds
+    SkyRecaptureAngleThreshold = 2.0f;
+    SkyRecaptureColorThreshold = 0.05f;
+    SkyRecaptureIntensityThreshold = 0.5f;
+    
+    LastCapturedSunRotation = FRotator::ZeroRotator;
+    LastCapturedSunColor = FLinearColor::Black;
+    LastCapturedSunIntensity = 0.0f;
+    bSkyRecapturePending = false;
+    bSkyRecaptureForced = false;
+    TimeSinceSkyRecapture = 0.0f;
+    SkyRecapturesThisWindow = 0;
+    SkyRecaptureWindowTime = 0.0f;
 }
 
 void AWorldManager::BeginPlay()
 {
     Super::BeginPlay();
     
+    // Let other systems find us without searching the world
+    if (UWorldServicesSubsystem* WorldServices = UWorldServicesSubsystem::Get(this))
+    {
+        WorldServices->RegisterWorldManager(this);
+    }
+    
+    // Bake the day cycle so the per-frame update is a table lookup
+    BuildSunLightingTable();
+    
     // Initial setup of sun and weather
     UpdateSunPosition();
     UpdateWeatherEffects();
+    RequestSkyRecapture(true);
+    
+    // Start the weather schedule
+    SetWeatherSeed(WeatherSeed);
     
     // If using real-time, set the time of day to match the real world
     if (bUseRealTime)
@@ -58,6 +189,16 @@ void AWorldManager::BeginPlay()
     }
 }
 
+void AWorldManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorldServicesSubsystem* WorldServices = UWorldServicesSubsystem::Get(this))
+    {
+        WorldServices->UnregisterWorldManager(this);
+    }
+    
+    Super::EndPlay(EndPlayReason);
+}
+
 void AWorldManager::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -79,8 +220,14 @@ void AWorldManager::Tick(float DeltaTime)
         UpdateSunPosition();
     }
     
-    // Try to randomly change weather
-    TryRandomWeatherChange(DeltaTime);
+    // Step the weather schedule
+    AdvanceWeatherSchedule(DeltaTime);
+    
+    // Blend towards the current weather
+    UpdateWeatherTransition(DeltaTime);
+    
+    // Recapture the sky if the sun has moved enough and the budget allows it
+    UpdateSkyRecapture(DeltaTime);
 }
 
 void AWorldManager::SetTimeOfDay(float NewTime)
@@ -94,14 +241,35 @@ void AWorldManager::SetTimeOfDay(float NewTime)
     
     // Update sun position and related effects
     UpdateSunPosition();
+    
+    // An explicit time jump should be visible straight away
+    RequestSkyRecapture(true);
 }
 
-void AWorldManager::SetWeather(EWeatherType NewWeather)
+void AWorldManager::SetWeather(EWeatherType NewWeather, bool bImmediate)
 {
     if (CurrentWeather != NewWeather)
     {
         CurrentWeather = NewWeather;
-        UpdateWeatherEffects();
+        
+        if (bImmediate || WeatherTransitionDuration <= 0.0f)
+        {
+            UpdateWeatherEffects();
+            
+            // Cloud cover changes the sky, capture it once the budget allows
+            RequestSkyRecapture(false, true);
+        }
+        else
+        {
+            // Start from whatever is on screen now, which may itself be mid-transition
+            TransitionFromWeather = AppliedWeather;
+            TransitionToWeather = GetWeatherPreset(NewWeather);
+            WeatherTransitionAlpha = 0.0f;
+            bWeatherTransitioning = true;
+        }
+        
+        // The schedule continues from the new weather
+        RefreshUpcomingWeather();
     }
 }
 
@@ -110,261 +278,455 @@ void AWorldManager::UpdateSunPosition()
     if (!SunLight)
         return;
     
-    // Convert time of day to rotator for sun
-    // 0 = midnight, 6 = sunrise, 12 = noon, 18 = sunset
+    if (SunLightingTable.Num() == 0)
+    {
+        BuildSunLightingTable();
+    }
+    
+    // Blend between the two nearest baked samples
+    const float TablePosition = (TimeOfDay / 24.0f) * SunLightingTable.Num();
+    const int32 Index0 = FMath::Clamp(FMath::FloorToInt(TablePosition), 0, SunLightingTable.Num() - 1);
+    const int32 Index1 = (Index0 + 1) % SunLightingTable.Num();
+    const float Alpha = TablePosition - Index0;
+    
+    const FSunLightingSample& Sample0 = SunLightingTable[Index0];
+    const FSunLightingSample& Sample1 = SunLightingTable[Index1];
     
-    // Calculate sun's pitch and yaw based on time
     // We want the sun to rise in the east (90 degrees) and set in the west (270 degrees)
     float SunYaw = 90.0f + (TimeOfDay / 24.0f) * 360.0f;
-    
-    // Calculate pitch to simulate sun's arc (highest at noon, lowest at midnight)
-    // Using a sinusoidal curve to simulate the sun's arc
-    float SunPitch = -90.0f + 180.0f * FMath::Sin(FMath::DegreesToRadians((TimeOfDay / 24.0f) * 360.0f));
+    float SunPitch = FMath::Lerp(Sample0.Pitch, Sample1.Pitch, Alpha);
     
     // Set the sun's rotation
     FRotator SunRotation(SunPitch, SunYaw, 0.0f);
     SunLight->SetWorldRotation(SunRotation);
     
-    // Adjust sun brightness based on time of day
-    float SunBrightness = 0.0f;
+    SunLight->SetIntensity(FMath::Lerp(Sample0.Intensity, Sample1.Intensity, Alpha));
+    SunLight->SetLightColor(FMath::Lerp(Sample0.Color, Sample1.Color, Alpha));
+    
+    // Only recapture the sky light once the sun has changed noticeably
+    RequestSkyRecapture(false);
+}
+
+void AWorldManager::BuildSunLightingTable()
+{
+    // One sample per game minute
+    const int32 NumSamples = 24 * 60;
+    SunLightingTable.SetNumUninitialized(NumSamples);
     
-    // Only have sun brightness between 6 AM and 6 PM
-    if (TimeOfDay > 6.0f && TimeOfDay < 18.0f)
+    for (int32 i = 0; i < NumSamples; ++i)
     {
-        // Normalize the time between 6 AM and 6 PM to a 0-1 range
-        float NormalizedTime = (TimeOfDay - 6.0f) / 12.0f;
-        
-        // Use a sine curve to make it peak at noon
-        SunBrightness = FMath::Sin(NormalizedTime * PI);
+        SunLightingTable[i] = EvaluateSunLighting(24.0f * i / NumSamples);
     }
+}
+
+AWorldManager::FSunLightingSample AWorldManager::EvaluateSunLighting(float Time) const
+{
+    FSunLightingSample Sample;
     
-    // Scale the brightness to a reasonable range
-    SunBrightness = SunBrightness * 10.0f + 0.2f;
-    SunLight->SetIntensity(SunBrightness);
+    // Convert time of day to sun pitch
+    // 0 = midnight, 6 = sunrise, 12 = noon, 18 = sunset
+    if (DayCycleProfile && DayCycleProfile->SunPitchCurve)
+    {
+        Sample.Pitch = DayCycleProfile->SunPitchCurve->GetFloatValue(Time);
+    }
+    else
+    {
+        // Using a sinusoidal curve to simulate the sun's arc
+        Sample.Pitch = -90.0f + 180.0f * FMath::Sin(FMath::DegreesToRadians((Time / 24.0f) * 360.0f));
+    }
+    
+    // Adjust sun brightness based on time of day
+    if (DayCycleProfile && DayCycleProfile->SunIntensityCurve)
+    {
+        Sample.Intensity = DayCycleProfile->SunIntensityCurve->GetFloatValue(Time);
+    }
+    else
+    {
+        float SunBrightness = 0.0f;
+        
+        // Only have sun brightness between 6 AM and 6 PM
+        if (Time > 6.0f && Time < 18.0f)
+        {
+            // Normalize the time between 6 AM and 6 PM to a 0-1 range
+            float NormalizedTime = (Time - 6.0f) / 12.0f;
+            
+            // Use a sine curve to make it peak at noon
+            SunBrightness = FMath::Sin(NormalizedTime * PI);
+        }
+        
+        // Scale the brightness to a reasonable range
+        Sample.Intensity = SunBrightness * 10.0f + 0.2f;
+    }
     
     // Adjust sun and sky colors based on time of day
-    FLinearColor MorningColor = FLinearColor(1.0f, 0.8f, 0.5f); // Warm, golden sunrise
-    FLinearColor DayColor = FLinearColor(1.0f, 1.0f, 1.0f);     // Bright, white day
-    FLinearColor EveningColor = FLinearColor(1.0f, 0.5f, 0.2f); // Orange, warm sunset
-    FLinearColor NightColor = FLinearColor(0.1f, 0.1f, 0.2f);   // Dark blue night
+    if (DayCycleProfile && DayCycleProfile->SunColorCurve)
+    {
+        Sample.Color = DayCycleProfile->SunColorCurve->GetLinearColorValue(Time);
+    }
+    else
+    {
+        FLinearColor MorningColor = FLinearColor(1.0f, 0.8f, 0.5f); // Warm, golden sunrise
+        FLinearColor DayColor = FLinearColor(1.0f, 1.0f, 1.0f);     // Bright, white day
+        FLinearColor EveningColor = FLinearColor(1.0f, 0.5f, 0.2f); // Orange, warm sunset
+        FLinearColor NightColor = FLinearColor(0.1f, 0.1f, 0.2f);   // Dark blue night
+        
+        if (Time < 6.0f) // Night to sunrise transition
+        {
+            float Alpha = Time / 6.0f;
+            Sample.Color = FLinearColor::LerpUsingHSV(NightColor, MorningColor, Alpha);
+        }
+        else if (Time < 12.0f) // Sunrise to midday
+        {
+            float Alpha = (Time - 6.0f) / 6.0f;
+            Sample.Color = FLinearColor::LerpUsingHSV(MorningColor, DayColor, Alpha);
+        }
+        else if (Time < 18.0f) // Midday to sunset
+        {
+            float Alpha = (Time - 12.0f) / 6.0f;
+            Sample.Color = FLinearColor::LerpUsingHSV(DayColor, EveningColor, Alpha);
+        }
+        else // Sunset to night
+        {
+            float Alpha = (Time - 18.0f) / 6.0f;
+            Sample.Color = FLinearColor::LerpUsingHSV(EveningColor, NightColor, Alpha);
+        }
+    }
     
-    FLinearColor SunColor;
+    return Sample;
+}
+
+void AWorldManager::RequestSkyRecapture(bool bForce, bool bSceneChanged)
+{
+    if (!SkyLight || !SunLight)
+        return;
     
-    if (TimeOfDay < 6.0f) // Night to sunrise transition
+    // Real-time capture already updates itself, time-sliced by the renderer
+    if (SkyLight->bRealTimeCapture)
+        return;
+    
+    if (bForce)
     {
-        float Alpha = TimeOfDay / 6.0f;
-        SunColor = FLinearColor::LerpUsingHSV(NightColor, MorningColor, Alpha);
+        bSkyRecapturePending = true;
+        bSkyRecaptureForced = true;
+        return;
     }
-    else if (TimeOfDay < 12.0f) // Sunrise to midday
+    
+    if (bSceneChanged)
     {
-        float Alpha = (TimeOfDay - 6.0f) / 6.0f;
-        SunColor = FLinearColor::LerpUsingHSV(MorningColor, DayColor, Alpha);
+        bSkyRecapturePending = true;
+        return;
     }
-    else if (TimeOfDay < 18.0f) // Midday to sunset
+    
+    const FRotator SunRotation = SunLight->GetComponentRotation();
+    const bool bAngleChanged = !SunRotation.Equals(LastCapturedSunRotation, SkyRecaptureAngleThreshold);
+    const bool bColorChanged = !SunLight->GetLightColor().Equals(LastCapturedSunColor, SkyRecaptureColorThreshold);
+    const bool bIntensityChanged = FMath::Abs(SunLight->Intensity - LastCapturedSunIntensity) > SkyRecaptureIntensityThreshold;
+    
+    if (bAngleChanged || bColorChanged || bIntensityChanged)
     {
-        float Alpha = (TimeOfDay - 12.0f) / 6.0f;
-        SunColor = FLinearColor::LerpUsingHSV(DayColor, EveningColor, Alpha);
+        bSkyRecapturePending = true;
     }
-    else // Sunset to night
+}
+
+void AWorldManager::UpdateSkyRecapture(float DeltaTime)
+{
+    TimeSinceSkyRecapture += DeltaTime;
+    
+    // Publish recaptures per minute for stat OpenWorldExplorer
+    SkyRecaptureWindowTime += DeltaTime;
+    if (SkyRecaptureWindowTime >= 60.0f)
     {
-        float Alpha = (TimeOfDay - 18.0f) / 6.0f;
-        SunColor = FLinearColor::LerpUsingHSV(EveningColor, NightColor, Alpha);
+        SET_DWORD_STAT(STAT_SkyRecapturesPerMinute, SkyRecapturesThisWindow);
+        SkyRecapturesThisWindow = 0;
+        SkyRecaptureWindowTime = 0.0f;
     }
     
-    SunLight->SetLightColor(SunColor);
+    if (!bSkyRecapturePending || !SkyLight || !SunLight)
+        return;
+    
+    // Spread captures out so at most the budgeted number run each minute
+    const float CapturesPerMinute = CVarSkyRecaptureBudget.GetValueOnGameThread();
+    if (!bSkyRecaptureForced && (CapturesPerMinute <= 0.0f || TimeSinceSkyRecapture < 60.0f / CapturesPerMinute))
+        return;
+    
+    SkyLight->RecaptureScene();
     
-    // Update the sky light to capture the new sun position
-    if (SkyLight)
+    LastCapturedSunRotation = SunLight->GetComponentRotation();
+    LastCapturedSunColor = SunLight->GetLightColor();
+    LastCapturedSunIntensity = SunLight->Intensity;
+    bSkyRecapturePending = false;
+    bSkyRecaptureForced = false;
+    TimeSinceSkyRecapture = 0.0f;
+    SkyRecapturesThisWindow++;
+}
+
+void AWorldManager::UpdateWeatherEffects()
+{
+    bWeatherTransitioning = false;
+    WeatherTransitionAlpha = 1.0f;
+    
+    ApplyWeatherPreset(GetWeatherPreset(CurrentWeather), true);
+}
+
+void AWorldManager::UpdateWeatherTransition(float DeltaTime)
+{
+    if (!bWeatherTransitioning)
+        return;
+    
+    WeatherTransitionAlpha = FMath::Min(WeatherTransitionAlpha + DeltaTime / FMath::Max(WeatherTransitionDuration, KINDA_SMALL_NUMBER), 1.0f);
+    
+    // Ease in and out so the change doesn't start or stop abruptly
+    const float BlendAlpha = FMath::SmoothStep(0.0f, 1.0f, WeatherTransitionAlpha);
+    ApplyWeatherPreset(FWeatherPreset::Blend(TransitionFromWeather, TransitionToWeather, BlendAlpha), false);
+    
+    if (WeatherTransitionAlpha >= 1.0f)
     {
-        SkyLight->RecaptureScene();
+        bWeatherTransitioning = false;
+        
+        // Capture the clouds we ended on, a capture at the start would bake in the old weather
+        RequestSkyRecapture(false, true);
     }
 }
 
-void AWorldManager::UpdateWeatherEffects()
+void AWorldManager::ApplyWeatherPreset(const FWeatherPreset& Preset, bool bForce)
 {
-    // Set weather-specific effects based on the current weather type
+    SCOPE_CYCLE_COUNTER(STAT_WeatherUpdate);
+    
     if (!WeatherPostProcess || !VolumetricClouds)
         return;
     
-    // Set volumetric cloud density and coverage based on weather
+    const float Tolerance = 0.001f;
+    
+    // Clouds - only touch the component when a value moved, each write dirties its render state
+    if (bForce || !FMath::IsNearlyEqual(Preset.CloudBottomAltitude, AppliedWeather.CloudBottomAltitude, 1.0f))
+    {
+        VolumetricClouds->SetLayerBottomAltitude(Preset.CloudBottomAltitude);
+    }
+    
+    if (bForce || !FMath::IsNearlyEqual(Preset.CloudLayerHeight, AppliedWeather.CloudLayerHeight, 1.0f))
+    {
+        VolumetricClouds->SetLayerHeight(Preset.CloudLayerHeight);
+    }
+    
+    if (bForce || !Preset.CloudSettings.Equals(AppliedWeather.CloudSettings, Tolerance))
+    {
+        VolumetricClouds->SetVolumetricCloudSettings(Preset.CloudSettings.X, Preset.CloudSettings.Y, Preset.CloudSettings.Z);
+    }
+    
+    // Post process - every weather writes every setting, so nothing is left over from a previous weather
+    FPostProcessSettings& Settings = WeatherPostProcess->Settings;
+    
+    if (bForce || !FVector(Preset.ColorSaturation).Equals(FVector(AppliedWeather.ColorSaturation), Tolerance))
+    {
+        Settings.bOverride_ColorSaturation = true;
+        Settings.ColorSaturation = Preset.ColorSaturation;
+    }
+    
+    if (bForce || !FVector(Preset.ColorContrast).Equals(FVector(AppliedWeather.ColorContrast), Tolerance))
+    {
+        Settings.bOverride_ColorContrast = true;
+        Settings.ColorContrast = Preset.ColorContrast;
+    }
+    
+    if (bForce || !FVector(Preset.ColorGain).Equals(FVector(AppliedWeather.ColorGain), Tolerance))
+    {
+        Settings.bOverride_ColorGain = true;
+        Settings.ColorGain = Preset.ColorGain;
+    }
+    
+    if (bForce || !FMath::IsNearlyEqual(Preset.DepthOfFieldAmount, AppliedWeather.DepthOfFieldAmount, Tolerance) ||
+        !FMath::IsNearlyEqual(Preset.DepthOfFieldFocalDistance, AppliedWeather.DepthOfFieldFocalDistance, 1.0f))
+    {
+        const bool bUseDepthOfField = Preset.DepthOfFieldAmount > Tolerance;
+        Settings.bOverride_DepthOfFieldMethod = bUseDepthOfField;
+        Settings.DepthOfFieldMethod = EDepthOfFieldMethod::DOFM_Gaussian;
+        Settings.bOverride_DepthOfFieldFocalDistance = bUseDepthOfField;
+        Settings.DepthOfFieldFocalDistance = Preset.DepthOfFieldFocalDistance;
+        Settings.bOverride_DepthOfFieldFstop = bUseDepthOfField;
+        Settings.DepthOfFieldFstop = Preset.DepthOfFieldFstop;
+    }
+    
+    if (WeatherParticles)
+    {
+        WeatherParticles->SetEffectIntensities(Preset.RainIntensity, Preset.LightningIntensity, Preset.FogIntensity, Preset.SnowIntensity);
+    }
+    
+    AppliedWeather = Preset;
+}
+
+const FWeatherPreset& AWorldManager::GetWeatherPreset(EWeatherType Weather) const
+{
+    static const FWeatherPreset DefaultPreset;
+    
+    const FWeatherPreset* Preset = WeatherPresets.Find(Weather);
+    return Preset ? *Preset : DefaultPreset;
+}
+
+// Built-in transitions for weather types the transition table doesn't cover
+static EWeatherType PickDefaultNextWeather(EWeatherType CurrentWeather, float RandomValue)
+{
+    // More likely to go to related weather states (e.g., Clear->Cloudy, Cloudy->Rain, etc.)
+    EWeatherType NextWeather = CurrentWeather;
+    
     switch (CurrentWeather)
     {
         case EWeatherType::Clear:
-            VolumetricClouds->LayerBottomAltitude = 5000.0f;
-            VolumetricClouds->LayerHeight = 2000.0f;
-            VolumetricClouds->SetVolumetricCloudSettings(0.5f, 0.2f, 0.5f);  // Low density and coverage
-            
-            // Reset post-process effects
-            WeatherPostProcess->Settings.bOverride_DepthOfFieldMethod = false;
-            WeatherPostProcess->Settings.bOverride_SceneFringeIntensity = false;
+            // From clear, most likely to go to cloudy, small chance for fog
+            if (RandomValue < 0.8f)
+                NextWeather = EWeatherType::Cloudy;
+            else
+                NextWeather = EWeatherType::Fog;
             break;
             
         case EWeatherType::Cloudy:
-            VolumetricClouds->LayerBottomAltitude = 4000.0f;
-            VolumetricClouds->LayerHeight = 3000.0f;
-            VolumetricClouds->SetVolumetricCloudSettings(0.7f, 0.6f, 0.5f);  // Medium density, high coverage
-            
-            // No special post-process effects for cloudy
-            WeatherPostProcess->Settings.bOverride_DepthOfFieldMethod = false;
-            WeatherPostProcess->Settings.bOverride_SceneFringeIntensity = false;
+            // From cloudy, can go to clear, rain, or rarely snow (if cold)
+            if (RandomValue < 0.3f)
+                NextWeather = EWeatherType::Clear;
+            else if (RandomValue < 0.8f)
+                NextWeather = EWeatherType::Rain;
+            else
+                NextWeather = EWeatherType::Snow;
             break;
             
         case EWeatherType::Rain:
-            VolumetricClouds->LayerBottomAltitude = 2000.0f;
-            VolumetricClouds->LayerHeight = 4000.0f;
-            VolumetricClouds->SetVolumetricCloudSettings(0.8f, 0.8f, 0.7f);  // High density and coverage
-            
-            // Rain effects (slight blur and dark tint)
-            WeatherPostProcess->Settings.bOverride_ColorSaturation = true;
-            WeatherPostProcess->Settings.ColorSaturation = FVector4(0.8f, 0.8f, 0.8f, 1.0f);
-            
-            // Spawn particle systems for rain if we have them
-            SpawnWeatherParticles(true, false, false);
+            // From rain, can go to cloudy or escalate to storm
+            if (RandomValue < 0.6f)
+                NextWeather = EWeatherType::Cloudy;
+            else
+                NextWeather = EWeatherType::Storm;
             break;
             
         case EWeatherType::Storm:
-            VolumetricClouds->LayerBottomAltitude = 1000.0f;
-            VolumetricClouds->LayerHeight = 5000.0f;
-            VolumetricClouds->SetVolumetricCloudSettings(0.9f, 0.9f, 0.8f);  // Very high density and coverage
-            
-            // Storm effects (darker, more contrast)
-            WeatherPostProcess->Settings.bOverride_ColorContrast = true;
-            WeatherPostProcess->Settings.ColorContrast = FVector4(1.2f, 1.2f, 1.2f, 1.0f);
-            WeatherPostProcess->Settings.bOverride_ColorSaturation = true;
-            WeatherPostProcess->Settings.ColorSaturation = FVector4(0.7f, 0.7f, 0.7f, 1.0f);
-            
-            // Spawn particle systems for heavy rain and lightning if we have them
-            SpawnWeatherParticles(true, true, false);
+            // Storm usually calms to rain
+            NextWeather = EWeatherType::Rain;
             break;
             
         case EWeatherType::Fog:
-            VolumetricClouds->LayerBottomAltitude = 0.0f;
-            VolumetricClouds->LayerHeight = 2000.0f;
-            VolumetricClouds->SetVolumetricCloudSettings(0.2f, 0.3f, 0.5f);  // Low density, medium coverage
-            
-            // Fog effects (blur for distance)
-            WeatherPostProcess->Settings.bOverride_DepthOfFieldMethod = true;
-            WeatherPostProcess->Settings.DepthOfFieldMethod = EDepthOfFieldMethod::DOFM_Gaussian;
-            WeatherPostProcess->Settings.bOverride_DepthOfFieldFocalDistance = true;
-            WeatherPostProcess->Settings.DepthOfFieldFocalDistance = 5000.0f;
-            WeatherPostProcess->Settings.bOverride_DepthOfFieldFstop = true;
-            WeatherPostProcess->Settings.DepthOfFieldFstop = 2.0f;
-            
-            // Spawn fog particle systems if we have them
-            SpawnWeatherParticles(false, false, true);
+            // Fog usually clears up or turns cloudy
+            if (RandomValue < 0.7f)
+                NextWeather = EWeatherType::Clear;
+            else
+                NextWeather = EWeatherType::Cloudy;
             break;
             
         case EWeatherType::Snow:
-            VolumetricClouds->LayerBottomAltitude = 3000.0f;
-            VolumetricClouds->LayerHeight = 3000.0f;
-            VolumetricClouds->SetVolumetricCloudSettings(0.8f, 0.7f, 0.6f);  // High density, medium coverage
-            
-            // Snow effects (bright, slightly blue tint)
-            WeatherPostProcess->Settings.bOverride_ColorGain = true;
-            WeatherPostProcess->Settings.ColorGain = FVector4(0.9f, 0.95f, 1.1f, 1.0f);
-            
-            // Spawn snow particle systems if we have them
-            SpawnWeatherParticles(false, false, false, true);
+            // Snow usually goes to cloudy or clear
+            if (RandomValue < 0.7f)
+                NextWeather = EWeatherType::Cloudy;
+            else
+                NextWeather = EWeatherType::Clear;
             break;
     }
+    
+    return NextWeather;
+}
+
+void AWorldManager::SetWeatherSeed(int32 Seed)
+{
+    WeatherSeed = Seed;
+    WeatherRandom.Initialize(Seed != 0 ? Seed : FMath::Rand());
+    WeatherStepAccumulator = 0.0f;
+    
+    UE_LOG(LogTemp, Log, TEXT("Weather schedule seed: %d"), WeatherRandom.GetInitialSeed());
+    
+    RefreshUpcomingWeather();
+}
+
+bool AWorldManager::StepWeatherSchedule(FRandomStream& Random, EWeatherType& Weather) const
+{
+    // Always draw both values so every step consumes the stream the same way
+    const float ChangeRoll = Random.FRand();
+    const float WeatherRoll = Random.FRand();
+    
+    const float ChanceThisStep = WeatherChangeProbability * WeatherStepSeconds / 60.0f;
+    if (ChangeRoll >= ChanceThisStep)
+        return false;
+    
+    EWeatherType NextWeather = Weather;
+    if (!WeatherTransitions || !WeatherTransitions->PickNextWeather(Weather, WeatherRoll, NextWeather))
+    {
+        NextWeather = PickDefaultNextWeather(Weather, WeatherRoll);
+    }
+    
+    if (NextWeather == Weather)
+        return false;
+    
+    Weather = NextWeather;
+    return true;
 }
 
-void AWorldManager::TryRandomWeatherChange(float DeltaTime)
+void AWorldManager::AdvanceWeatherSchedule(float DeltaTime)
 {
-    // Calculate chance of weather change this frame
-    float ChanceThisFrame = WeatherChangeProbability * DeltaTime / 60.0f; // Adjust to per-frame probability
+    if (WeatherStepSeconds <= 0.0f)
+        return;
     
-    // Roll random chance
-    if (FMath::FRand() < ChanceThisFrame)
+    // Fixed steps keep the schedule independent of frame rate
+    WeatherStepAccumulator += DeltaTime;
+    while (WeatherStepAccumulator >= WeatherStepSeconds)
     {
-        // Determine next weather type
-        // More likely to go to related weather states (e.g., Clear->Cloudy, Cloudy->Rain, etc.)
+        WeatherStepAccumulator -= WeatherStepSeconds;
         
         EWeatherType NextWeather = CurrentWeather;
-        float RandomValue = FMath::FRand();
-        
-        switch (CurrentWeather)
+        if (StepWeatherSchedule(WeatherRandom, NextWeather))
         {
-            case EWeatherType::Clear:
-                // From clear, most likely to go to cloudy, small chance for fog
-                if (RandomValue < 0.8f)
-                    NextWeather = EWeatherType::Cloudy;
-                else
-                    NextWeather = EWeatherType::Fog;
-                break;
-                
-            case EWeatherType::Cloudy:
-                // From cloudy, can go to clear, rain, or rarely snow (if cold)
-                if (RandomValue < 0.3f)
-                    NextWeather = EWeatherType::Clear;
-                else if (RandomValue < 0.8f)
-                    NextWeather = EWeatherType::Rain;
-                else
-                    NextWeather = EWeatherType::Snow;
-                break;
-                
-            case EWeatherType::Rain:
-                // From rain, can go to cloudy or escalate to storm
-                if (RandomValue < 0.6f)
-                    NextWeather = EWeatherType::Cloudy;
-                else
-                    NextWeather = EWeatherType::Storm;
-                break;
-                
-            case EWeatherType::Storm:
-                // Storm usually calms to rain
-                NextWeather = EWeatherType::Rain;
-                break;
-                
-            case EWeatherType::Fog:
-                // Fog usually clears up or turns cloudy
-                if (RandomValue < 0.7f)
-                    NextWeather = EWeatherType::Clear;
-                else
-                    NextWeather = EWeatherType::Cloudy;
-                break;
-                
-            case EWeatherType::Snow:
-                // Snow usually goes to cloudy or clear
-                if (RandomValue < 0.7f)
-                    NextWeather = EWeatherType::Cloudy;
-                else
-                    NextWeather = EWeatherType::Clear;
-                break;
+            SetWeather(NextWeather);
         }
-        
-        // Apply the new weather
-        if (NextWeather != CurrentWeather)
+        else if (StepsUntilWeatherChange > 0)
         {
-            SetWeather(NextWeather);
+            --StepsUntilWeatherChange;
+        }
+    }
+    
+    // Let listeners stream in what the next weather needs before it arrives
+    if (!bUpcomingWeatherAnnounced && StepsUntilWeatherChange != INDEX_NONE)
+    {
+        const float SecondsUntilChange = StepsUntilWeatherChange * WeatherStepSeconds - WeatherStepAccumulator;
+        if (SecondsUntilChange <= WeatherPrestreamLeadTime)
+        {
+            bUpcomingWeatherAnnounced = true;
+            OnWeatherApproaching.Broadcast(UpcomingWeather, SecondsUntilChange);
         }
     }
 }
 
-void AWorldManager::SpawnWeatherParticles(bool bRain, bool bLightning, bool bFog, bool bSnow)
+void AWorldManager::RefreshUpcomingWeather()
 {
-    // Find the player pawn to attach weather particles to it
-    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
-    if (!PlayerPawn)
-        return;
+    StepsUntilWeatherChange = INDEX_NONE;
+    bUpcomingWeatherAnnounced = false;
+    
+    // Run a copy of the schedule forward, it makes the same draws the real one will
+    FRandomStream Random = WeatherRandom;
+    EWeatherType Weather = CurrentWeather;
+    for (int32 Step = 1; Step <= MaxWeatherForecastSteps; ++Step)
+    {
+        if (StepWeatherSchedule(Random, Weather))
+        {
+            UpcomingWeather = Weather;
+            StepsUntilWeatherChange = Step;
+            break;
+        }
+    }
+}
+
+TArray<FWeatherForecastEntry> AWorldManager::GetWeatherForecast(int32 Count) const
+{
+    TArray<FWeatherForecastEntry> Forecast;
+    if (Count <= 0 || WeatherStepSeconds <= 0.0f)
+        return Forecast;
+    
+    Forecast.Reserve(Count);
+    
+    FRandomStream Random = WeatherRandom;
+    EWeatherType Weather = CurrentWeather;
+    for (int32 Step = 1; Step <= MaxWeatherForecastSteps && Forecast.Num() < Count; ++Step)
+    {
+        if (StepWeatherSchedule(Random, Weather))
+        {
+            FWeatherForecastEntry& Entry = Forecast.AddDefaulted_GetRef();
+            Entry.Weather = Weather;
+            Entry.SecondsFromNow = Step * WeatherStepSeconds - WeatherStepAccumulator;
+        }
+    }
     
-    // This is a placeholder function that would spawn particle systems for the different weather effects
-    // In a real implementation, you would spawn and attach appropriate particle systems to the camera
-    
-    // For example:
-    // if (bRain && RainParticleSystem)
-    // {
-    //     UGameplayStatics::SpawnEmitterAttached(
-    //         RainParticleSystem,
-    //         PlayerPawn->GetRootComponent(),
-    //         NAME_None,
-    //         FVector(0, 0, 500),  // Offset above player
-    //         FRotator::ZeroRotator,
-    //         FVector(1, 1, 1),
-    //         EAttachLocation::KeepRelativeOffset,
-    //         true
-    //     );
-    // }
-    
-    // Similar code would be used for lightning, fog, and snow effects
+    return Forecast;
 }
\ No newline at end of file
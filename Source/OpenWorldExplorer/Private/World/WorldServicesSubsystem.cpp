@@ -0,0 +1,58 @@
+#include "World/WorldServicesSubsystem.h"
+#include "World/WorldManager.h"
+#include "World/ProgressionSystem.h"
+#include "World/PhotoGallerySubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+UWorldServicesSubsystem* UWorldServicesSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UWorldServicesSubsystem>() : nullptr;
+}
+
+void UWorldServicesSubsystem::RegisterWorldManager(AWorldManager* InWorldManager)
+{
+    if (WorldManager.IsValid() && WorldManager.Get() != InWorldManager)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("More than one world manager in the world, using %s"), *GetNameSafe(InWorldManager));
+    }
+
+    WorldManager = InWorldManager;
+}
+
+void UWorldServicesSubsystem::UnregisterWorldManager(AWorldManager* InWorldManager)
+{
+    if (WorldManager.Get() == InWorldManager)
+    {
+        WorldManager.Reset();
+    }
+}
+
+UProgressionSystem* UWorldServicesSubsystem::GetProgressionSystem()
+{
+    if (!ProgressionSystem.IsValid())
+    {
+        UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+        if (GameInstance)
+        {
+            ProgressionSystem = Cast<UProgressionSystem>(GameInstance->GetSubsystem<UProgressionSystem>());
+        }
+    }
+
+    return ProgressionSystem.Get();
+}
+
+UPhotoGallerySubsystem* UWorldServicesSubsystem::GetPhotoGallery()
+{
+    if (!PhotoGallery.IsValid())
+    {
+        UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+        if (GameInstance)
+        {
+            PhotoGallery = GameInstance->GetSubsystem<UPhotoGallerySubsystem>();
+        }
+    }
+
+    return PhotoGallery.Get();
+}
\ No newline at end of file
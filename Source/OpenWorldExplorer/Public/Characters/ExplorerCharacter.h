@@ -75,6 +75,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Character|Vehicle")
     void ExitVehicle();
 
+    // Hide the character inside Vehicle, it stays there until LeaveVehicle
+    void ParkInVehicle(class ABaseVehicle* Vehicle);
+
+    // Bring a parked character back at ExitLocation, possession is left to the caller
+    void LeaveVehicle(const FVector& ExitLocation, const FRotator& ExitRotation);
+
     // Character customization functions
     UFUNCTION(BlueprintCallable, Category = "Character|Customization")
     void SetCharacterAppearance(class USkeletalMesh* HeadMesh, class USkeletalMesh* BodyMesh);
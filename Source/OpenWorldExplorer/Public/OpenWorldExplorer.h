@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleInterface.h"
+#include "Stats/Stats.h"
+
+// Stat group for game-side systems (stat OpenWorldExplorer)
+DECLARE_STATS_GROUP(TEXT("OpenWorldExplorer"), STATGROUP_OpenWorldExplorer, STATCAT_Advanced);
 
 /**
  * Module for OpenWorldExplorer game
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Pawn.h"
+#include "Vehicles/VehicleSurface.h"
+#include "Vehicles/VehicleSignificanceSubsystem.h"
 #include "BaseVehicle.generated.h"
 
 /**
@@ -17,13 +19,16 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PossessedBy(AController* NewController) override;
+	virtual void UnPossessed() override;
 
 	// Core vehicle components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
 	class USkeletalMeshComponent* VehicleMesh;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
-	class UChaosVehicleMovementComponent* VehicleMovement;
+	class UChaosWheeledVehicleMovementComponent* VehicleMovement;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
 	class USpringArmComponent* CameraBoom;
@@ -31,6 +36,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
 	class UCameraComponent* FollowCamera;
 
+	// Accumulates distance driven and reports it to progression
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
+	class UVehicleOdometerComponent* Odometer;
+
 	// Vehicle properties
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle")
 	float MaxSpeed;
@@ -44,6 +53,17 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle")
 	float TurnRate;
 
+	// Project physical surface types as vehicle surfaces, anything not listed is road
+	UPROPERTY(EditAnywhere, Category = "Vehicle|Terrain")
+	TMap<TEnumAsByte<EPhysicalSurface>, EVehicleSurface> PhysicalSurfaceMap;
+
+	// How this vehicle responds to each surface, surfaces not listed behave like plain road
+	UPROPERTY(EditAnywhere, Category = "Vehicle|Terrain")
+	TMap<EVehicleSurface, FVehicleSurfaceResponse> SurfaceResponses;
+
+	// Flatten the surface maps into lookup tables, entries in Overrides replace SurfaceResponses
+	void RebuildSurfaceTables(const TMap<EVehicleSurface, FVehicleSurfaceResponse>* Overrides = nullptr);
+
 	// Input bindings
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input)
 	class UInputMappingContext* VehicleMappingContext;
@@ -71,18 +91,18 @@ public:
 	
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
-	// Vehicle control functions
+	// Vehicle control functions, the latest value of each is sent to the movement component on the next tick
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Control")
-	virtual void ApplyThrottle(float Value);
+	void ApplyThrottle(float Value);
 
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Control")
-	virtual void ApplySteering(float Value);
+	void ApplySteering(float Value);
 
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Control")
-	virtual void ApplyBrake(float Value);
+	void ApplyBrake(float Value);
 
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Control")
-	virtual void ApplyHandbrake(bool bEnabled);
+	void ApplyHandbrake(bool bEnabled);
 
 	// Camera functions
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Camera")
@@ -92,6 +112,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Interaction")
 	void ExitVehicle();
 
+	// Move to a significance tier and run at its update rates, called by UVehicleSignificanceSubsystem
+	void SetSignificance(EVehicleSignificance NewSignificance);
+
+	UFUNCTION(BlueprintPure, Category = "Vehicle|Significance")
+	EVehicleSignificance GetSignificance() const { return Significance; }
+
+	// Slower than SpeedThreshold (cm/s) with every wheel on the ground
+	bool IsAtRest(float SpeedThreshold) const;
+
+	// Surface under most of the wheels
+	UFUNCTION(BlueprintPure, Category = "Vehicle|Terrain")
+	EVehicleSurface GetCurrentSurface() const { return CurrentSurface; }
+
 	// Customization functions
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Customization")
 	virtual void SetVehicleColor(const FLinearColor& Color);
@@ -103,6 +136,69 @@ private:
 	// Current camera view state
 	bool bIsFirstPersonView;
 
+	EVehicleSignificance Significance;
+
+	// Engine sound added by the vehicle class, if any
+	UPROPERTY()
+	class UVehicleEngineAudioComponent* EngineAudio;
+
+	// Read every wheel's contact surface and apply the combined response
+	void UpdateSurfaceResponse(float DeltaTime);
+
+	// Per-wheel surface values, one lane per wheel so they're processed four at a time
+	struct FWheelSurfaceBlock
+	{
+		static const int32 MaxWheels = 8;
+
+		alignas(16) float Contact[MaxWheels];
+		alignas(16) float Traction[MaxWheels];
+		alignas(16) float RollingResistance[MaxWheels];
+		alignas(16) float Throttle[MaxWheels];
+		alignas(16) float Steering[MaxWheels];
+		alignas(16) float MaxThrottle[MaxWheels];
+	};
+
+	FWheelSurfaceBlock WheelSurfaces;
+
+	// Friction last sent to each wheel, only changes are sent again
+	float AppliedWheelFriction[FWheelSurfaceBlock::MaxWheels];
+
+	// Indexed by EPhysicalSurface and EVehicleSurface, so lookups never search
+	EVehicleSurface SurfaceByPhysicalSurface[SurfaceType_Max];
+	FVehicleSurfaceResponse ActiveSurfaceResponses[(int32)EVehicleSurface::Count];
+
+	EVehicleSurface CurrentSurface;
+
+	// Input scaling averaged over the wheels on the ground
+	float SurfaceThrottleScale;
+	float SurfaceSteeringScale;
+	float SurfaceMaxThrottle;
+
+	// Driver input for one frame
+	struct FVehicleInputFrame
+	{
+		float Throttle = 0.0f;
+		float Steering = 0.0f;
+		float Brake = 0.0f;
+		bool bHandbrake = false;
+	};
+
+	// Latest value from every input event this frame
+	FVehicleInputFrame PendingInput;
+
+	// Scaled input last sent to the movement component, only changes are sent again
+	FVehicleInputFrame AppliedInput;
+
+	// Scale the pending input by the surface response and send it to the movement component
+	void FlushInput();
+
+	// Bring a parked vehicle back to ticking so its input gets flushed
+	void WakeForInput();
+
+	// Something hit a parked vehicle, it needs its wheels and suspension before the next score
+	UFUNCTION()
+	void OnBodyWake(class UPrimitiveComponent* WakingComponent, FName BoneName);
+
 	// Process input for Enhanced Input system
 	void ProcessThrottleInput(const struct FInputActionValue& Value);
 	void ProcessSteeringInput(const struct FInputActionValue& Value);
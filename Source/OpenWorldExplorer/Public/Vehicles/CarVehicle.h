@@ -21,7 +21,7 @@ protected:
 
 	// Car-specific components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
-	class UAudioComponent* EngineSound;
+	class UVehicleEngineAudioComponent* EngineSound;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
 	class UStaticMeshComponent* BodyworkMesh;
@@ -46,8 +46,6 @@ protected:
 	float TopSpeed;
 
 public:
-	virtual void Tick(float DeltaTime) override;
-
 	// Car-specific customization methods
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Customization")
 	void SetBodywork(UStaticMesh* NewBodyworkMesh);
@@ -63,8 +61,4 @@ public:
 
 	// Override from BaseVehicle
 	virtual void SetVehicleColor(const FLinearColor& Color) override;
-
-private:
-	// Update engine sound based on RPM
-	void UpdateEngineSound(float CurrentRPM);
 };
\ No newline at end of file
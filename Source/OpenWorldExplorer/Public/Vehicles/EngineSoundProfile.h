@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "EngineSoundProfile.generated.h"
+
+/**
+ * How a vehicle class's engine sounds across its rev range.
+ * Curves are keyed by engine RPM. Any curve left empty falls back
+ * to the engine audio component's linear ramp.
+ */
+UCLASS(BlueprintType)
+class OPENWORLDEXPLORER_API UEngineSoundProfile : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// Pitch multiplier
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Engine Sound")
+	class UCurveFloat* PitchCurve;
+
+	// Volume multiplier
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Engine Sound")
+	class UCurveFloat* VolumeCurve;
+
+	// Crossfade between the sound's idle and high rev layers (0-1)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Engine Sound")
+	class UCurveFloat* LayerBlendCurve;
+
+	// Sound parameter the layer blend is sent to
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Engine Sound")
+	FName LayerBlendParameter = TEXT("RPMBlend");
+};
\ No newline at end of file
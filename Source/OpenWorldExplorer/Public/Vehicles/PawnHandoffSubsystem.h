@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "PawnHandoffSubsystem.generated.h"
+
+/**
+ * Moves the player between their character and vehicles without spawning.
+ * The character that got in is parked in the vehicle and handed back on exit,
+ * drivers of destroyed vehicles are kept for the next vehicle that needs one.
+ */
+UCLASS()
+class OPENWORLDEXPLORER_API UPawnHandoffSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Called by a character when it gets into Vehicle
+	void RegisterDriver(class ABaseVehicle* Vehicle, class AExplorerCharacter* Character);
+
+	// Find a free spot next to Vehicle and hand control to its driver there, completes a frame later
+	UFUNCTION(BlueprintCallable, Category = "Vehicle|Interaction")
+	void RequestExit(class ABaseVehicle* Vehicle);
+
+	// An exit for Vehicle is waiting on its queries
+	UFUNCTION(BlueprintPure, Category = "Vehicle|Interaction")
+	bool IsExitPending(const class ABaseVehicle* Vehicle) const;
+
+private:
+	// Exit spots tried around a vehicle, in order of preference
+	static const int32 NumExitCandidates = 4;
+
+	struct FPendingExit
+	{
+		TWeakObjectPtr<class ABaseVehicle> Vehicle;
+		TWeakObjectPtr<class AExplorerCharacter> Character;
+		// Who drove and where from, in case the vehicle is gone before the sweeps come back
+		TWeakObjectPtr<class AController> Controller;
+		FVector FallbackLocation;
+		float Yaw;
+		FTraceHandle Handles[NumExitCandidates];
+		FVector Locations[NumExitCandidates];
+		bool bValid[NumExitCandidates];
+		int32 Remaining;
+	};
+
+	// A character to drive Vehicle, its own driver, a pooled one or as a last resort a new one
+	class AExplorerCharacter* TakeDriver(class ABaseVehicle* Vehicle);
+
+	// Drivers of vehicles that no longer exist go back in the pool
+	void ReclaimOrphanedDrivers();
+
+	void OnExitSweepDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceData);
+
+	void CompleteExit(const FPendingExit& Exit);
+
+	TMap<TWeakObjectPtr<class ABaseVehicle>, TWeakObjectPtr<class AExplorerCharacter>> Drivers;
+
+	UPROPERTY()
+	TArray<class AExplorerCharacter*> IdleCharacters;
+
+	TArray<FPendingExit> PendingExits;
+
+	// Class used if a character ever has to be spawned, follows whatever the player last drove with
+	UPROPERTY()
+	TSubclassOf<class AExplorerCharacter> CharacterClass;
+
+	FTraceDelegate ExitSweepDelegate;
+};
\ No newline at end of file
@@ -16,7 +16,6 @@ class OPENWORLDEXPLORER_API ASUVVehicle : public ABaseVehicle
 public:
 	ASUVVehicle();
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
 
 	// SUV-specific functions
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Lights")
@@ -31,14 +30,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Vehicle|Customization")
 	void SetBullBar(UStaticMesh* NewBullBarMesh);
 
-	// Override from BaseVehicle for SUV-specific handling
-	virtual void ApplyThrottle(float Value) override;
-	virtual void ApplySteering(float Value) override;
-
 protected:
 	// SUV-specific components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
-	class UAudioComponent* EngineSound;
+	class UVehicleEngineAudioComponent* EngineSound;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Vehicle")
 	class UStaticMeshComponent* RoofRackMesh;
@@ -56,8 +51,9 @@ protected:
 	class USpotLightComponent* RoofSpotlight;
 
 	// SUV settings
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Terrain")
-	float OffroadTractionMultiplier;
+	// Surface responses that replace SurfaceResponses while offroad mode is on
+	UPROPERTY(EditAnywhere, Category = "Vehicle|Terrain")
+	TMap<EVehicleSurface, FVehicleSurfaceResponse> OffroadSurfaceResponses;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Terrain")
 	float WaterDepthTolerance;
@@ -66,12 +62,6 @@ protected:
 	float MaxTorque;
 
 private:
-	// Terrain detection for SUV-specific handling
-	void UpdateTerrainDetection();
-
-	// Current terrain type the vehicle is on
-	FName CurrentTerrainType;
-
 	// Is offroad mode enabled (better handling on rough terrain)
 	bool bOffroadModeEnabled;
 
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/AudioComponent.h"
+#include "VehicleEngineAudioComponent.generated.h"
+
+/**
+ * Engine sound driven by the owning vehicle's RPM.
+ * Parameters are only sent to the audio thread once they've moved far
+ * enough to hear, and vehicles away from the player update less often
+ * or stop their sound entirely until they're back in range.
+ */
+UCLASS(ClassGroup=(Audio), meta=(BlueprintSpawnableComponent))
+class OPENWORLDEXPLORER_API UVehicleEngineAudioComponent : public UAudioComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleEngineAudioComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Sound is stopped because the vehicle is out of range
+	UFUNCTION(BlueprintPure, Category = "Vehicle|Audio")
+	bool IsVirtualized() const { return bVirtualized; }
+
+	// Stop the sound and ticking while the vehicle is parked, the sound comes back once it wakes in range
+	void SetDormant(bool bDormant);
+
+	// Curves for this vehicle class
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio")
+	class UEngineSoundProfile* SoundProfile;
+
+	// Linear ramp used for any curve the profile doesn't have
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio", meta = (ClampMin = "1.0"))
+	float FallbackMaxRPM;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio")
+	FVector2D FallbackPitchRange;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio")
+	FVector2D FallbackVolumeRange;
+
+	// Smallest relative pitch change worth sending, around a tenth of a semitone
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio|Updates", meta = (ClampMin = "0.0"))
+	float PitchThreshold;
+
+	// Smallest volume change worth sending
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio|Updates", meta = (ClampMin = "0.0"))
+	float VolumeThreshold;
+
+	// Smallest layer blend change worth sending
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio|Updates", meta = (ClampMin = "0.0"))
+	float LayerBlendThreshold;
+
+	// Unpossessed vehicles closer than this to the listener update every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio|Updates", meta = (ClampMin = "0.0"))
+	float FullRateDistance;
+
+	// Unpossessed vehicles further than this stop their sound
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio|Updates", meta = (ClampMin = "0.0"))
+	float VirtualizeDistance;
+
+	// Seconds between updates for vehicles between the two distances
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio|Updates", meta = (ClampMin = "0.0"))
+	float LowRateInterval;
+
+	// Seconds between range checks while virtualized
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Audio|Updates", meta = (ClampMin = "0.0"))
+	float VirtualizedInterval;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	// Pick the update rate for how far away and how important the vehicle is, false while virtualized
+	bool UpdateAudioLOD();
+
+	// Work out pitch, volume and blend from RPM and send what has changed enough
+	void UpdateEngineParameters();
+
+	float EvaluateCurve(const class UCurveFloat* Curve, float RPM, const FVector2D& FallbackRange) const;
+
+	TWeakObjectPtr<class UChaosWheeledVehicleMovementComponent> VehicleMovement;
+
+	// Values last sent to the audio thread, negative when nothing has been sent
+	float SentPitch;
+	float SentVolume;
+	float SentLayerBlend;
+
+	bool bVirtualized;
+};
\ No newline at end of file
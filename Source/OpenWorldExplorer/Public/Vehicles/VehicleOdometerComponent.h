@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "VehicleOdometerComponent.generated.h"
+
+/**
+ * Per-vehicle odometer that accumulates distance locally and
+ * reports it to the progression system in batches
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class OPENWORLDEXPLORER_API UVehicleOdometerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVehicleOdometerComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Send any distance not yet reported to the progression system
+	UFUNCTION(BlueprintCallable, Category = "Vehicle|Odometer")
+	void FlushToProgression();
+
+	// Total distance this vehicle has travelled, in meters
+	UFUNCTION(BlueprintPure, Category = "Vehicle|Odometer")
+	float GetOdometerMeters() const { return (float)OdometerMeters; }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Seconds between reports to the progression system
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Odometer", meta = (ClampMin = "0.1"))
+	float FlushInterval;
+
+	// Unreported distance (meters) that triggers a report before the interval is up
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Odometer", meta = (ClampMin = "1.0"))
+	float FlushDistance;
+
+	// Movement below this (meters) is held until it adds up, to filter out physics jitter
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Odometer")
+	float MinStepDistance;
+
+private:
+	// Resolve the progression system once and cache it
+	class UProgressionSystem* GetProgressionSystem();
+
+	// Owner location when distance was last accumulated
+	FVector LastLocation;
+
+	// Lifetime distance for this vehicle (meters)
+	double OdometerMeters;
+
+	// Distance driven by a player that hasn't been reported yet (meters)
+	double PendingMeters;
+
+	// Time since the last report
+	float TimeSinceFlush;
+
+	TWeakObjectPtr<class UProgressionSystem> CachedProgressionSystem;
+};
\ No newline at end of file
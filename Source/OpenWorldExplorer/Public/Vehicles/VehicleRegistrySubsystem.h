@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "VehicleRegistrySubsystem.generated.h"
+
+/**
+ * Every vehicle in the world, kept up to date by the vehicles themselves
+ * so systems don't need to iterate actors to find them
+ */
+UCLASS()
+class OPENWORLDEXPLORER_API UVehicleRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Called from ABaseVehicle::BeginPlay and EndPlay
+	void RegisterVehicle(class ABaseVehicle* Vehicle);
+	void UnregisterVehicle(class ABaseVehicle* Vehicle);
+
+	// All vehicles currently in play, order is not stable
+	const TArray<class ABaseVehicle*>& GetVehicles() const { return Vehicles; }
+
+	UFUNCTION(BlueprintPure, Category = "Vehicle")
+	int32 GetNumVehicles() const { return Vehicles.Num(); }
+
+private:
+	UPROPERTY()
+	TArray<class ABaseVehicle*> Vehicles;
+};
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "VehicleSignificanceSubsystem.generated.h"
+
+/**
+ * How much a vehicle matters to the player right now, most to least
+ */
+UENUM(BlueprintType)
+enum class EVehicleSignificance : uint8
+{
+	Player,
+	High,
+	Medium,
+	Low,
+	// Parked and unpossessed, ticking, physics and sound are off
+	Dormant
+};
+
+// Update rates a vehicle runs at for one significance tier
+struct FVehicleSignificanceTier
+{
+	float TickInterval;
+	float MeshTickInterval;
+	EVisibilityBasedAnimTickOption AnimTickOption;
+};
+
+/**
+ * Scores the registered vehicles against the player camera a few at a time
+ * and moves each one to the tier that matches how much it can be seen
+ */
+UCLASS()
+class OPENWORLDEXPLORER_API UVehicleSignificanceSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	virtual TStatId GetStatId() const override;
+
+	// Update rates used for a tier
+	static const FVehicleSignificanceTier& GetTierSettings(EVehicleSignificance Significance);
+
+	// Score a vehicle now rather than waiting for its turn
+	void RefreshVehicle(class ABaseVehicle* Vehicle);
+
+	// Hold every vehicle in its current tier, used while photo mode has frozen the world
+	void SetScoringPaused(bool bPaused) { bScoringPaused = bPaused; }
+
+private:
+	EVehicleSignificance EvaluateSignificance(const class ABaseVehicle* Vehicle, const FVector& ViewLocation, float ScreenScale) const;
+
+	// Where the round robin over the registry picks up next frame
+	int32 NextVehicle = 0;
+
+	bool bScoringPaused = false;
+};
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VehicleSurface.generated.h"
+
+// Surfaces vehicles handle differently, physical surface types map onto these
+UENUM(BlueprintType)
+enum class EVehicleSurface : uint8
+{
+	Road,
+	Dirt,
+	Grass,
+	Sand,
+	Snow,
+	Ice,
+	Water,
+	Count UMETA(Hidden)
+};
+
+// How a surface changes a vehicle's controls
+USTRUCT(BlueprintType)
+struct FVehicleSurfaceResponse
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Terrain")
+	float ThrottleMultiplier = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Terrain")
+	float SteeringMultiplier = 1.0f;
+
+	// Scales tire friction on wheels touching the surface
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Terrain")
+	float TractionMultiplier = 1.0f;
+
+	// Rolling resistance coefficient, the share of each wheel's load that drags against motion
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Terrain", meta = (ClampMin = "0.0"))
+	float RollingResistance = 0.0f;
+
+	// Largest throttle input allowed, after the multiplier
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vehicle|Terrain", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MaxThrottle = 1.0f;
+};
\ No newline at end of file
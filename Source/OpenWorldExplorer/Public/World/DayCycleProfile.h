@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "DayCycleProfile.generated.h"
+
+/**
+ * Designer-authored day curves for the world manager's sun.
+ * Curves are keyed by time of day in hours (0-24). Any curve left
+ * empty falls back to the built-in day cycle.
+ */
+UCLASS(BlueprintType)
+class OPENWORLDEXPLORER_API UDayCycleProfile : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    // Sun pitch in degrees (-90 = straight down, 90 = overhead)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sun")
+    class UCurveFloat* SunPitchCurve;
+
+    // Directional light intensity
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sun")
+    class UCurveFloat* SunIntensityCurve;
+
+    // Directional light color
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sun")
+    class UCurveLinearColor* SunColorCurve;
+};
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "World/PhotographySystem.h"
+#include "PhotoGallerySubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGalleryThumbnailLoaded, int32, PhotoIndex, class UTexture2D*, Thumbnail);
+
+/**
+ * Catalog of every photo taken, stored as a compact binary file next to the photos.
+ * Queries run against in-memory indices and thumbnails are loaded on demand,
+ * so browsing the gallery never touches the full-size images.
+ */
+UCLASS()
+class OPENWORLDEXPLORER_API UPhotoGallerySubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UPhotoGallerySubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Add a finished photo to the catalog
+    void AddPhoto(const FPhotoMetadata& Metadata);
+
+    // Path of the thumbnail written alongside a photo
+    static FString GetThumbnailPath(const FString& PhotoPath);
+
+    UFUNCTION(BlueprintPure, Category = "Photography|Gallery")
+    int32 GetNumPhotos() const { return Photos.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Photography|Gallery")
+    bool GetPhoto(int32 PhotoIndex, FPhotoMetadata& OutMetadata) const;
+
+    // Photo indices matching a query, oldest first
+    UFUNCTION(BlueprintCallable, Category = "Photography|Gallery")
+    TArray<int32> FindPhotosByLocation(const FString& LocationName) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Photography|Gallery")
+    TArray<int32> FindPhotosByWeather(const FString& WeatherCondition) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Photography|Gallery")
+    TArray<int32> FindPhotosByFilter(EPhotoFilter Filter) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Photography|Gallery")
+    TArray<int32> FindPhotosByVehicle(const FString& VehicleName) const;
+
+    // Cached thumbnail for a photo, or nullptr while it loads (OnThumbnailLoaded fires when it's ready)
+    UFUNCTION(BlueprintCallable, Category = "Photography|Gallery")
+    class UTexture2D* GetThumbnail(int32 PhotoIndex);
+
+    UPROPERTY(BlueprintAssignable, Category = "Photography|Gallery")
+    FOnGalleryThumbnailLoaded OnThumbnailLoaded;
+
+    // Thumbnails kept in memory, least recently used ones are dropped first
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Gallery", meta = (ClampMin = "1"))
+    int32 MaxCachedThumbnails;
+
+private:
+    // Read every record from the catalog file
+    void LoadCatalog();
+
+    // Add a photo to the lookup indices
+    void IndexPhoto(int32 PhotoIndex);
+
+    // Thumbnail file has been read on a worker
+    void OnThumbnailDataLoaded(int32 PhotoIndex, const TArray<uint8>& CompressedData);
+
+    // Mark a cached thumbnail as just used
+    void TouchThumbnail(int32 PhotoIndex);
+
+    // Every photo in the order it was taken
+    TArray<FPhotoMetadata> Photos;
+
+    // Photo indices by metadata value
+    TMap<FName, TArray<int32>> PhotosByLocation;
+    TMap<FName, TArray<int32>> PhotosByWeather;
+    TMap<FName, TArray<int32>> PhotosByVehicle;
+    TMap<EPhotoFilter, TArray<int32>> PhotosByFilter;
+
+    FString CatalogPath;
+
+    // Last catalog append, each append waits on the one before
+    FGraphEventRef LastCatalogWrite;
+
+    UPROPERTY()
+    TMap<int32, class UTexture2D*> ThumbnailCache;
+
+    // Cached photo indices, most recently used last
+    TArray<int32> ThumbnailLru;
+
+    TSet<int32> PendingThumbnailLoads;
+};
\ No newline at end of file
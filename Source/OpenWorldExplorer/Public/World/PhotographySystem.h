@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Containers/Queue.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "WorldCollision.h"
 #include "PhotographySystem.generated.h"
 
 // Filter types for photography
@@ -19,12 +22,78 @@ enum class EPhotoFilter : uint8
 	Vibrant
 };
 
+// Settings the uber filter material uses to produce one filter
+USTRUCT(BlueprintType)
+struct FPhotoFilterParameters
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography")
+	float Saturation = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography")
+	float Contrast = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography")
+	float Brightness = 1.0f;
+
+	// Blend towards a sepia tone (0-1)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography")
+	float SepiaAmount = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography")
+	float VignetteIntensity = 0.0f;
+
+	// Multiplied into the final color
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography")
+	FLinearColor Tint = FLinearColor::White;
+};
+
+// File format photos are saved in
+UENUM(BlueprintType)
+enum class EPhotoFileFormat : uint8
+{
+	PNG,
+	JPEG
+};
+
+// Outcome and per-stage timings of one photo capture
+USTRUCT(BlueprintType)
+struct FPhotoCaptureResult
+{
+	GENERATED_BODY()
+
+	// Where the photo was written
+	UPROPERTY(BlueprintReadOnly, Category = "Photography")
+	FString FilePath;
+
+	// Whether the file was written successfully
+	UPROPERTY(BlueprintReadOnly, Category = "Photography")
+	bool bSaved = false;
+
+	// Time from requesting the capture to receiving the frame's pixels
+	UPROPERTY(BlueprintReadOnly, Category = "Photography")
+	float ReadbackMs = 0.0f;
+
+	// Time spent compressing the image on a worker thread
+	UPROPERTY(BlueprintReadOnly, Category = "Photography")
+	float EncodeMs = 0.0f;
+
+	// Time spent writing the file on a worker thread
+	UPROPERTY(BlueprintReadOnly, Category = "Photography")
+	float WriteMs = 0.0f;
+};
+
 // Photo metadata saved with each photo
 USTRUCT(BlueprintType)
 struct FPhotoMetadata
 {
 	GENERATED_BODY()
 
+	// File the photo was saved to
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString FilePath;
+
 	// Location where photo was taken
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FVector Location;
@@ -69,6 +138,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Camera components
 	UPROPERTY()
@@ -78,10 +148,18 @@ protected:
 	UPROPERTY()
 	class UPostProcessComponent* PhotoEffects;
 
-	// Materials for different filters
+	// Materials for different filters, used when there is no uber filter material
 	UPROPERTY(EditDefaultsOnly, Category = "Photography|Effects")
 	TMap<EPhotoFilter, class UMaterialInterface*> FilterMaterials;
 
+	// Single post process material that produces every filter from FilterParameters
+	UPROPERTY(EditDefaultsOnly, Category = "Photography|Effects")
+	class UMaterialInterface* UberFilterMaterial;
+
+	// Uber filter settings per filter
+	UPROPERTY(EditDefaultsOnly, Category = "Photography|Effects")
+	TMap<EPhotoFilter, FPhotoFilterParameters> FilterParameters;
+
 	// Current filter selection
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings")
 	EPhotoFilter CurrentFilter;
@@ -96,10 +174,59 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "10.0", ClampMax = "170.0"))
 	float MaxFOV;
 
-	// Photo resolution
+	// Vehicles further than this from the camera aren't listed in photo metadata
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "0.0"))
+	float VehicleDetectionRange;
+
+	// Resolution of tiled photos, normal photos use the viewport's
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings")
 	FIntPoint PhotoResolution;
 
+	// Render PhotoResolution in tiles, for photos larger than the screen. Always saved as PNG, and burst is unavailable.
+	// Every tile is rendered and read back on the game thread before TakePhoto returns, so large photos hitch for up to a few seconds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings")
+	bool bTiledCapture;
+
+	// Largest tile side, keep within the platform's render target limits
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "64", ClampMax = "4096"))
+	int32 MaxTileSize;
+
+	// CPU memory a tiled photo may hold at once, whatever its resolution
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "1"))
+	int32 TiledCaptureMemoryBudgetMB;
+
+	// Saved photo format
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings")
+	EPhotoFileFormat PhotoFormat;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "1", ClampMax = "100"))
+	int32 JpegQuality;
+
+	// Width of the gallery thumbnail saved next to each photo, height follows the aspect ratio
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "16"))
+	int32 ThumbnailWidth;
+
+	// Photos that may wait on encoding or writing at once, each holds a full frame until it's encoded
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "1"))
+	int32 MaxPhotosInFlight;
+
+	// Stop offscreen actors and slow visible ones while in photo mode
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings")
+	bool bFreezeWorldInPhotoMode;
+
+	// Actors the freeze visits per frame after entering photo mode and ticks the thaw restores per frame after leaving,
+	// neither entry nor exit walks the world itself
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "1"))
+	int32 FreezeActorsPerFrame;
+
+	// Seconds between ticks for actors still on screen while the world is frozen
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "0.0"))
+	float FrozenVisibleTickInterval;
+
+	// Rendering resolution while the world is frozen, spends the frame time the freeze saves
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|Settings", meta = (ClampMin = "50.0", ClampMax = "200.0"))
+	float PhotoModeScreenPercentage;
+
 	// Photography UI
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Photography|UI")
 	TSubclassOf<class UUserWidget> ViewfinderWidgetClass;
@@ -128,6 +255,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Photography")
 	void TakePhoto();
 
+	// Take ShotCount photos at ShotsPerSecond, waiting whenever MaxPhotosInFlight is reached. Refused with tiled capture
+	UFUNCTION(BlueprintCallable, Category = "Photography")
+	void StartBurst(int32 ShotCount, float ShotsPerSecond);
+
+	UFUNCTION(BlueprintCallable, Category = "Photography")
+	void StopBurst();
+
+	// Metadata of the most recent photo once its vehicle detection has finished
+	UFUNCTION(BlueprintPure, Category = "Photography")
+	FPhotoMetadata GetLastPhotoMetadata() const { return LastPhotoMetadata; }
+
+	// Result of the most recently saved photo
+	UFUNCTION(BlueprintPure, Category = "Photography")
+	FPhotoCaptureResult GetLastCaptureResult() const { return LastCaptureResult; }
+
 	// Change the current filter
 	UFUNCTION(BlueprintCallable, Category = "Photography")
 	void SetFilter(EPhotoFilter NewFilter);
@@ -155,25 +297,208 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Photography")
 	bool IsInPhotoMode() const { return bInPhotoMode; }
 
+	// The world is still being frozen or thawed over the following frames
+	bool IsFreezeInProgress() const { return bFreezeInProgress; }
+	bool IsThawInProgress() const { return bThawInProgress; }
+
 private:
 	// Apply current filter to the post process material
 	void ApplyCurrentFilter();
 
-	// Capture the photo and save it to disk
-	void CaptureScreenshot();
+	// Create the filter material instances and their blendables, only does work the first time
+	void CreateFilterInstances();
+
+	// Create the viewfinder once and keep it collapsed in the viewport until photo mode
+	void CreateViewfinderWidget();
+
+	// Camera on Pawn, looked up again only when the pawn changes
+	class UCameraComponent* GetPlayerCamera(class APawn* Pawn);
+
+	// Queue a capture of the next frame, it's encoded and saved off the game thread. Returns the photo's path
+	FString CaptureScreenshot();
+
+	// Render PhotoResolution tile by tile and stream it to a PNG, returns the photo's path
+	FString CaptureTiledScreenshot();
+
+	// Scene capture and render target for tiles, reused between photos
+	void CreateTileCapture(int32 TileWidth, int32 TileHeight);
+
+	// Ask the viewport for the next queued capture's pixels
+	void RequestNextScreenshot();
+
+	// Frame pixels are ready, hand them to the encode and write tasks
+	void OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Pixels);
+
+	// Pick up results from finished write tasks
+	void ProcessCompletedCaptures();
+
+	// Report a photo that never reached the encode and write tasks
+	void EnqueueFailedCapture(const FString& FilePath);
+
+	// Unique path for a new photo
+	FString MakePhotoFilePath(EPhotoFileFormat Format);
 
 	// Generate metadata for the current photo
 	FPhotoMetadata GeneratePhotoMetadata();
 
+	// Start freezing the rest of the world, the work is spread over the following frames
+	void BeginFreezeWorld(class APlayerController* PlayerController);
+
+	// Freeze the next FreezeActorsPerFrame actors
+	void ContinueFreezeWorld();
+
+	// Disable or slow ticking and physics for one actor, remembering what was changed
+	void FreezeActor(AActor* Actor);
+
+	// Start undoing what the freeze changed, the work is spread over the following frames
+	void BeginThawWorld();
+
+	// Restore up to Budget of the frozen ticks and sleeping bodies
+	void ContinueThawWorld(int32 Budget);
+
+	// Undo everything the freeze changed right away
+	void ThawWorld();
+
+	// Services resolved once and cached
+	class AWorldManager* GetWorldManager();
+	class UProgressionSystem* GetProgressionSystem();
+	class UPhotoGallerySubsystem* GetPhotoGallery();
+
 	// Check for nearby points of interest
 	FString DetectNearbyLocationName();
 
 	// Get the current weather condition from the world manager
 	FString GetCurrentWeatherCondition();
 
-	// Check for vehicles in the photo frame
-	TArray<FString> DetectVehiclesInFrame();
+	// Trace to vehicles inside the camera frustum, Metadata is completed when the traces return next frame
+	void DetectVehiclesInFrame(FPhotoMetadata&& Metadata);
+
+	// An async visibility trace for a photo has finished
+	void OnVehicleTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceData);
+
+	// All information about a photo is known
+	void CompletePhotoMetadata(FPhotoMetadata& Metadata);
+
+	// Add a photo to the gallery, only once its file is known to be on disk
+	void CatalogPhoto(const FPhotoMetadata& Metadata);
 
 	// Is UI currently visible in photo mode
 	bool bUIVisible;
+
+	TWeakObjectPtr<class APawn> CachedCameraPawn;
+	TWeakObjectPtr<class UCameraComponent> CachedPlayerCamera;
+
+	TWeakObjectPtr<class AWorldManager> CachedWorldManager;
+	TWeakObjectPtr<class UProgressionSystem> CachedProgressionSystem;
+	TWeakObjectPtr<class UPhotoGallerySubsystem> CachedPhotoGallery;
+
+	// A tick function changed by the freeze and its interval before
+	struct FFrozenTick
+	{
+		TWeakObjectPtr<UObject> Object;
+		float TickInterval;
+	};
+
+	TArray<FFrozenTick> FrozenTicks;
+
+	// A physics body put to sleep by the freeze
+	struct FSleepingBody
+	{
+		TWeakObjectPtr<class UPrimitiveComponent> Body;
+		FVector LinearVelocity;
+		FVector AngularVelocity;
+	};
+
+	TArray<FSleepingBody> SleepingBodies;
+
+	int32 DormantActorCount;
+
+	// Where the spread out freeze picks up next frame, in World->GetLevels() and that level's Actors
+	bool bFreezeInProgress;
+	int32 FreezeLevelIndex;
+	int32 FreezeActorIndex;
+
+	// Where the spread out thaw picks up next frame, in FrozenTicks and then SleepingBodies
+	bool bThawInProgress;
+	int32 ThawTickIndex;
+	int32 ThawBodyIndex;
+
+	// Actors that keep running while the world is frozen
+	TArray<TWeakObjectPtr<AActor>> FreezeExemptActors;
+
+	// Metadata waiting on vehicle visibility traces
+	struct FPendingVehicleDetection
+	{
+		FPhotoMetadata Metadata;
+		TArray<FTraceHandle> TraceHandles;
+		TArray<TWeakObjectPtr<AActor>> Candidates;
+		int32 TracesRemaining = 0;
+	};
+
+	TArray<FPendingVehicleDetection> PendingVehicleDetections;
+
+	// Filter materials, created the first time photo mode opens
+	UPROPERTY()
+	class UMaterialInstanceDynamic* UberFilterInstance;
+
+	UPROPERTY()
+	TMap<EPhotoFilter, class UMaterialInstanceDynamic*> FilterInstances;
+
+	// Index of each filter's entry in the post process blendables
+	TMap<EPhotoFilter, int32> FilterBlendableIndex;
+
+	bool bFilterInstancesCreated;
+
+	FTraceDelegate VehicleTraceDelegate;
+
+	UPROPERTY()
+	FPhotoMetadata LastPhotoMetadata;
+
+	// Metadata and save results arrive in either order, each waits here for the other by file path
+	TMap<FString, FPhotoMetadata> MetadataAwaitingSave;
+	TMap<FString, bool> SaveResultsAwaitingMetadata;
+
+	// A capture waiting for its frame
+	struct FPendingPhotoCapture
+	{
+		FString FilePath;
+		double RequestTime;
+	};
+
+	TArray<FPendingPhotoCapture> PendingCaptures;
+
+	// The viewport has a screenshot request for the first pending capture
+	bool bScreenshotRequested;
+
+	FDelegateHandle ScreenshotCapturedHandle;
+
+	// Photo folder, created once at BeginPlay
+	FString ScreenshotDir;
+
+	// Photos per session, keeps file names unique within the same millisecond
+	int32 CaptureSequence;
+
+	// Photos handed to worker tasks that haven't finished writing
+	int32 PhotosInFlight;
+
+	// Last write task, each write waits on the one before so files land in order
+	FGraphEventRef LastWriteTask;
+
+	// Results pushed by write tasks, drained on the game thread
+	TSharedPtr<TQueue<FPhotoCaptureResult, EQueueMode::Mpsc>, ESPMode::ThreadSafe> CompletedCaptures;
+
+	FPhotoCaptureResult LastCaptureResult;
+
+	UPROPERTY()
+	class USceneCaptureComponent2D* TileCapture;
+
+	UPROPERTY()
+	class UTextureRenderTarget2D* TileTarget;
+
+	class IImageWrapperModule* ImageWrapperModule;
+
+	// Burst mode
+	int32 BurstShotsRemaining;
+	float BurstInterval;
+	float BurstTimer;
 };
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform grid over the XY plane holding point-of-interest positions by id.
+ * Ids are whatever the owner uses to find the POI, e.g. an array index.
+ * Queries visit ids in place and never copy the POIs themselves.
+ */
+class OPENWORLDEXPLORER_API FPointOfInterestGrid
+{
+public:
+    explicit FPointOfInterestGrid(float InCellSize = 10000.0f);
+
+    // Remove every point
+    void Reset();
+
+    // Add a point, ids are expected to be unique
+    void Add(int32 Id, const FVector& Location);
+
+    // Id of the closest point within MaxDistance, or INDEX_NONE
+    int32 FindNearest(const FVector& Location, float MaxDistance, float* OutDistanceSquared = nullptr) const;
+
+    // Call Visitor(Id, Location) for every point within Radius
+    template <typename VisitorType>
+    void ForEachInRadius(const FVector& Center, float Radius, VisitorType&& Visitor) const
+    {
+        const float RadiusSquared = Radius * Radius;
+        const FIntPoint MinCell = GetCell(Center - FVector(Radius, Radius, 0.0f));
+        const FIntPoint MaxCell = GetCell(Center + FVector(Radius, Radius, 0.0f));
+
+        for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+        {
+            for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+            {
+                const TArray<FEntry>* Entries = Cells.Find(FIntPoint(CellX, CellY));
+                if (!Entries)
+                    continue;
+
+                for (const FEntry& Entry : *Entries)
+                {
+                    if (FVector::DistSquared(Center, Entry.Location) <= RadiusSquared)
+                    {
+                        Visitor(Entry.Id, Entry.Location);
+                    }
+                }
+            }
+        }
+    }
+
+    int32 Num() const { return NumPoints; }
+
+private:
+    struct FEntry
+    {
+        int32 Id;
+        FVector Location;
+    };
+
+    FIntPoint GetCell(const FVector& Location) const
+    {
+        return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+    }
+
+    // Only occupied cells are stored, so sparse maps stay small
+    TMap<FIntPoint, TArray<FEntry>> Cells;
+
+    float CellSize;
+    int32 NumPoints;
+};
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "World/ProgressionSystem.h"
+#include "ProgressionSaveGame.generated.h"
+
+// Progression save format versions
+namespace EProgressionSaveVersion
+{
+    enum Type
+    {
+        Initial = 0,
+        // FAchievement::Counter replaces the AchievementType string
+        TypedAchievementCounters,
+        
+        LatestPlusOne,
+        Latest = LatestPlusOne - 1
+    };
+}
+
+/**
+ * SaveGame class for progression data
+ */
+UCLASS()
+class OPENWORLDEXPLORER_API UProgressionSaveGame : public USaveGame
+{
+    GENERATED_BODY()
+    
+public:
+    UPROPERTY()
+    TArray<FDiscoveredLocation> DiscoveredLocations;
+    
+    UPROPERTY()
+    TArray<FVehicleUnlock> VehicleUnlocks;
+    
+    UPROPERTY()
+    TArray<FCustomizationUnlock> CustomizationUnlocks;
+    
+    UPROPERTY()
+    TArray<FAchievement> Achievements;
+    
+    UPROPERTY()
+    float TotalDistanceTraveled;
+    
+    UPROPERTY()
+    float DistanceTraveledByVehicle;
+    
+    UPROPERTY()
+    float DistanceTraveledOnFoot;
+    
+    UPROPERTY()
+    int32 TotalPhotosTaken;
+    
+    UPROPERTY()
+    int32 ExplorationPoints;
+    
+    UPROPERTY()
+    int32 ExplorationLevel;
+    
+    // Saves written before versioning load as Initial
+    UPROPERTY()
+    int32 SaveVersion = EProgressionSaveVersion::Initial;
+};
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Async/Future.h"
+#include "World/PointOfInterestGrid.h"
 #include "ProgressionSystem.generated.h"
 
 // Struct to represent a discovered location
@@ -73,6 +75,20 @@ struct FCustomizationUnlock
     int32 RequiredExplorationPoints;
 };
 
+// Counters that achievements track progress against
+UENUM(BlueprintType)
+enum class EAchievementCounter : uint8
+{
+    None            UMETA(Hidden),
+    VehicleDistance,
+    FootDistance,
+    TotalDistance,
+    Discoveries,
+    Photos,
+    LocationPhotos,
+    MAX             UMETA(Hidden)
+};
+
 // Structure for achievement data
 USTRUCT(BlueprintType)
 struct FAchievement
@@ -91,8 +107,12 @@ struct FAchievement
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     int32 RewardPoints;
     
-    // Achievement type - distance, discoveries, photos, etc.
+    // Counter this achievement tracks - distance, discoveries, photos, etc.
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    EAchievementCounter Counter = EAchievementCounter::None;
+    
+    // Legacy string type, only read when migrating old saves
+    UPROPERTY()
     FString AchievementType;
     
     // Target value to complete the achievement
@@ -104,6 +124,45 @@ struct FAchievement
     float CurrentProgress;
 };
 
+// Hash key for customization unlocks (Category, ItemType, ItemID)
+struct FCustomizationUnlockKey
+{
+    FName Category;
+    FName ItemType;
+    FName ItemID;
+    
+    FCustomizationUnlockKey(FName InCategory, FName InItemType, FName InItemID)
+        : Category(InCategory), ItemType(InItemType), ItemID(InItemID)
+    {
+    }
+    
+    bool operator==(const FCustomizationUnlockKey& Other) const
+    {
+        return Category == Other.Category && ItemType == Other.ItemType && ItemID == Other.ItemID;
+    }
+    
+    friend uint32 GetTypeHash(const FCustomizationUnlockKey& Key)
+    {
+        return HashCombine(HashCombine(GetTypeHash(Key.Category), GetTypeHash(Key.ItemType)), GetTypeHash(Key.ItemID));
+    }
+};
+
+// Vehicle or customization unlock waiting on an exploration point threshold
+struct FPendingPointUnlock
+{
+    int32 RequiredPoints;
+    bool bIsVehicle;
+    int32 Index;
+};
+
+// Achievements of one counter, sorted by target value
+struct FAchievementCounterState
+{
+    float Value = 0.0f;
+    TArray<int32> AchievementsByTarget;
+    int32 NextPending = 0;
+};
+
 /**
  * Progression system for tracking player exploration, discoveries, and unlocks
  */
@@ -112,6 +171,9 @@ class OPENWORLDEXPLORER_API UProgressionSystem : public UObject, public FTickabl
 {
     GENERATED_BODY()
     
+    // Drives the unlock graph directly and compares it against a full rescan
+    friend class FProgressionUnlockParityTest;
+    
 public:
     UProgressionSystem();
     
@@ -124,10 +186,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Progression")
     void Initialize();
     
-    // Save and load progression data
+    // Save and load progression data. Saves are written asynchronously.
     UFUNCTION(BlueprintCallable, Category = "Progression")
     bool SaveProgressionData();
     
+    // Mark progression dirty; all requests within the debounce window are merged into one save
+    UFUNCTION(BlueprintCallable, Category = "Progression")
+    void RequestSave();
+    
+    // Synchronously write any pending changes (e.g. on level change or shutdown)
+    UFUNCTION(BlueprintCallable, Category = "Progression")
+    void FlushPendingSave();
+    
     UFUNCTION(BlueprintCallable, Category = "Progression")
     bool LoadProgressionData();
     
@@ -167,6 +237,23 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Progression|Exploration")
     TArray<FDiscoveredLocation> GetDiscoveredLocations() const;
     
+    // Closest discovered location within MaxDistance, false if there is none
+    UFUNCTION(BlueprintCallable, Category = "Progression|Exploration")
+    bool GetNearestDiscoveredLocation(const FVector& Location, float MaxDistance, FDiscoveredLocation& OutLocation) const;
+    
+    // Closest discovered location within MaxDistance, or nullptr
+    const FDiscoveredLocation* FindNearestDiscoveredLocation(const FVector& Location, float MaxDistance) const;
+    
+    // Call Visitor(const FDiscoveredLocation&) for every discovered location within Radius
+    template <typename VisitorType>
+    void ForEachDiscoveredLocationInRadius(const FVector& Center, float Radius, VisitorType&& Visitor) const
+    {
+        DiscoveredLocationGrid.ForEachInRadius(Center, Radius, [this, &Visitor](int32 LocationIndex, const FVector&)
+        {
+            Visitor(DiscoveredLocations[LocationIndex]);
+        });
+    }
+    
     // Get exploration statistics
     UFUNCTION(BlueprintCallable, Category = "Progression|Stats")
     int32 GetTotalDiscoveries() const;
@@ -203,7 +290,18 @@ public:
     
     // Update achievement progress
     UFUNCTION(BlueprintCallable, Category = "Progression|Achievements")
-    void UpdateAchievementProgress(const FString& AchievementType, float Progress);
+    void UpdateAchievementProgress(EAchievementCounter Counter, float Progress);
+    
+    // Current value of an achievement counter
+    UFUNCTION(BlueprintCallable, Category = "Progression|Achievements")
+    float GetAchievementCounterValue(EAchievementCounter Counter) const;
+    
+    // Save pipeline statistics
+    UFUNCTION(BlueprintCallable, Category = "Progression|Save")
+    float GetLastSaveLatencyMs() const { return LastSaveLatencyMs; }
+    
+    UFUNCTION(BlueprintCallable, Category = "Progression|Save")
+    int32 GetMergedSaveRequestCount() const { return TotalMergedSaveRequests; }
     
 private:
     // All discovered locations
@@ -222,6 +320,14 @@ private:
     UPROPERTY()
     TArray<FAchievement> Achievements;
     
+    // Name lookups into the arrays above, kept in sync on add and rebuilt after loading
+    TMap<FName, int32> DiscoveredLocationIndex;
+    TMap<FName, int32> VehicleUnlockIndex;
+    TMap<FCustomizationUnlockKey, int32> CustomizationUnlockIndex;
+    
+    // Discovered locations by position, ids are indices into DiscoveredLocations
+    FPointOfInterestGrid DiscoveredLocationGrid;
+    
     // Statistics
     UPROPERTY()
     float TotalDistanceTraveled;
@@ -241,12 +347,36 @@ private:
     UPROPERTY()
     int32 ExplorationLevel;
     
+    // Rebuild the name lookups from the unlock and discovery arrays
+    void RebuildLookupIndices();
+    
+    // Array index of a discovered location, or INDEX_NONE
+    int32 FindDiscoveredLocationIndex(const FString& LocationName) const;
+    
     // Calculate exploration level based on points
     void UpdateExplorationLevel();
     
     // Check for unlocks based on current progression
     void CheckForUnlocks();
     
+    // Update vehicles that were waiting on a newly discovered location
+    void NotifyLocationDiscovered(const FString& LocationName);
+    
+    // Build the unlock dependency graph from the current unlock state
+    void RebuildUnlockGraph();
+    
+    // Locked vehicles and customizations sorted by RequiredExplorationPoints
+    TArray<FPendingPointUnlock> PointUnlockQueue;
+    
+    // First entry in PointUnlockQueue whose points requirement hasn't been reached
+    int32 NextPointUnlock;
+    
+    // Per vehicle, how many required discoveries are still missing
+    TArray<int32> VehicleMissingDiscoveries;
+    
+    // Location name -> vehicles that still need it discovered
+    TMap<FName, TArray<int32>> VehiclesWaitingOnLocation;
+    
     // Award exploration points
     void AwardExplorationPoints(int32 Points);
     
@@ -256,6 +386,65 @@ private:
     // Create default achievements
     void CreateDefaultAchievements();
     
+    // Sort achievements into their counters and restore counter values
+    void RebuildAchievementCounters();
+    
+    // Copy counter values into the achievements' CurrentProgress
+    void FillAchievementProgress(TArray<FAchievement>& InOutAchievements) const;
+    
+    // Map the legacy AchievementType strings to counters
+    void MigrateLegacyAchievementTypes();
+    
+    // Progress and sorted thresholds per counter
+    FAchievementCounterState AchievementCounters[(int32)EAchievementCounter::MAX];
+    
+    // Set up default vehicle and customization unlocks
+    void SetupDefaultVehicles();
+    void SetupDefaultCustomizations();
+    
+    // Helper to build an achievement entry
+    FAchievement CreateAchievement(const FString& Name, const FString& Description, EAchievementCounter Counter, float Target, int32 Reward);
+    
     // Level thresholds - points needed for each level
     TArray<int32> LevelThresholds;
+    
+    // Copy current state into the reusable save object
+    class UProgressionSaveGame* CreateSaveSnapshot();
+    
+    // Start an async write of the current state
+    bool DispatchAsyncSave();
+    
+    // Called on the game thread once the in-flight write has finished
+    void OnAsyncSaveComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess);
+    
+    // Slot write running on a worker thread, owned here so a blocking flush can wait for it
+    TFuture<bool> InFlightSave;
+    
+    // Reused save object for snapshots
+    UPROPERTY()
+    class UProgressionSaveGame* SaveSnapshot;
+    
+    // Seconds to wait after the first save request before writing
+    float SaveDebounceSeconds;
+    
+    // There are changes that haven't been written yet
+    bool bSaveDirty;
+    
+    // An async write is in progress
+    bool bSaveInFlight;
+    
+    // When the current batch of save requests started
+    double FirstDirtyTime;
+    
+    // When the last async write was started
+    double SaveDispatchTime;
+    
+    // Save requests in the current batch
+    int32 PendingSaveRequests;
+    
+    // Total save requests merged into another write
+    int32 TotalMergedSaveRequests;
+    
+    // Time from dispatch to completion of the last write
+    float LastSaveLatencyMs;
 };
\ No newline at end of file
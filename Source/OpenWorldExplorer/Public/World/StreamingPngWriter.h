@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+/**
+ * Writes an 8-bit RGB PNG a band of rows at a time.
+ * Rows are compressed and flushed to disk as they arrive, so memory use
+ * depends on the row width and never on the image height.
+ */
+class OPENWORLDEXPLORER_API FStreamingPngWriter
+{
+public:
+    FStreamingPngWriter();
+    ~FStreamingPngWriter();
+
+    // Create the file and write the header, rows must follow top to bottom. CompressionLevel is zlib's 0-9
+    bool Open(const FString& FilePath, int32 InWidth, int32 InHeight, int32 CompressionLevel = 1);
+
+    // Append NumRows full-width rows, alpha is dropped
+    bool WriteRows(const FColor* Pixels, int32 NumRows);
+
+    // Finish the image, false if anything failed or rows are missing
+    bool Close();
+
+    bool IsOpen() const { return FileHandle.IsValid(); }
+
+private:
+    bool WriteChunk(const char* Type, const uint8* Data, int32 Size);
+
+    // Compress what's in the deflate input, writing out full IDAT chunks
+    bool Deflate(int32 Flush);
+
+    TUniquePtr<IFileHandle> FileHandle;
+
+    // zlib state, kept out of the header so users of the writer don't need zlib's include paths
+    struct FDeflateStream;
+    TUniquePtr<FDeflateStream> Deflater;
+    bool bFailed;
+
+    int32 Width;
+    int32 Height;
+    int32 RowsWritten;
+
+    // One filtered row and the compressed data waiting for its IDAT chunk
+    TArray<uint8> RowBuffer;
+    TArray<uint8> OutputBuffer;
+};
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WeatherParticleManager.generated.h"
+
+// How one weather effect is spawned around the camera
+USTRUCT(BlueprintType)
+struct FWeatherEmitterSettings
+{
+    GENERATED_BODY()
+
+    // Particle system for this effect, leave empty to disable it
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+    class UParticleSystem* Template = nullptr;
+
+    // Offset from the camera the emitter is attached to
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+    FVector Offset = FVector(0.0f, 0.0f, 500.0f);
+
+    // Particles per second at full intensity, passed to the template as "SpawnRate"
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather", meta = (ClampMin = "0.0"))
+    float MaxSpawnRate = 1000.0f;
+
+    // Particles alive at once at full intensity, used to estimate memory
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather", meta = (ClampMin = "0"))
+    int32 MaxActiveParticles = 2000;
+
+    // Particles further than this from the camera are not drawn, passed to the template as "CullDistance"
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather", meta = (ClampMin = "0.0"))
+    float CullDistance = 3000.0f;
+};
+
+/**
+ * Owns one pre-allocated emitter per weather effect and keeps them
+ * attached to the player's camera, whichever pawn that is
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class OPENWORLDEXPLORER_API UWeatherParticleManager : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UWeatherParticleManager();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    // Set how strong each effect is (0-1), effects at 0 are switched off
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void SetEffectIntensities(float Rain, float Lightning, float Fog, float Snow);
+
+    // Estimated particle memory currently in use, in kilobytes
+    UFUNCTION(BlueprintPure, Category = "Weather")
+    float GetEstimatedMemoryKB() const { return EstimatedMemoryKB; }
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+    FWeatherEmitterSettings Rain;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+    FWeatherEmitterSettings Lightning;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+    FWeatherEmitterSettings Fog;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+    FWeatherEmitterSettings Snow;
+
+    // Rough size of one live particle including its vertex data, in bytes
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather", meta = (ClampMin = "1"))
+    int32 BytesPerParticle;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    enum { NumEffects = 4 };
+
+    // Create every emitter up front so weather changes never allocate
+    void PrewarmEmitters();
+
+    // Move the emitters onto the current player pawn's camera
+    void AttachToPawn(APawn* Pawn);
+
+    // Push spawn rates to the emitters, scaled down to fit the memory budget
+    void ApplyIntensities();
+
+    const FWeatherEmitterSettings& GetSettings(int32 Effect) const;
+
+    UPROPERTY()
+    TArray<class UParticleSystemComponent*> Emitters;
+
+    // Requested intensity per effect
+    float Intensities[NumEffects];
+
+    // Spawn rate last written per effect
+    float AppliedSpawnRates[NumEffects];
+
+    // Pawn the emitters are currently attached to
+    TWeakObjectPtr<APawn> AttachedPawn;
+
+    float EstimatedMemoryKB;
+};
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "World/WorldManager.h"
+#include "WeatherTransitionTable.generated.h"
+
+// Relative chances of each weather following one weather type
+USTRUCT(BlueprintType)
+struct FWeatherTransitionRow
+{
+    GENERATED_BODY()
+
+    // Weight per next weather, weights don't need to add up to 1
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weather")
+    TMap<EWeatherType, float> NextWeatherWeights;
+};
+
+/**
+ * Markov transition matrix for the world manager's weather scheduler.
+ * Weather types without a row fall back to the built-in transitions.
+ */
+UCLASS(BlueprintType)
+class OPENWORLDEXPLORER_API UWeatherTransitionTable : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    // Transition row per current weather
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weather")
+    TMap<EWeatherType, FWeatherTransitionRow> Transitions;
+
+    // Pick the weather following From using a roll in [0, 1), returns false if From has no usable row
+    bool PickNextWeather(EWeatherType From, float Roll, EWeatherType& OutWeather) const;
+};
\ No newline at end of file
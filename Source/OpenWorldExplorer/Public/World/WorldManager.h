@@ -16,6 +16,76 @@ enum class EWeatherType : uint8
     Snow         UMETA(DisplayName = "Snow")
 };
 
+// Environment settings for one weather type
+USTRUCT(BlueprintType)
+struct FWeatherPreset
+{
+    GENERATED_BODY()
+
+    // Volumetric cloud layer
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clouds")
+    float CloudBottomAltitude = 5000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clouds")
+    float CloudLayerHeight = 2000.0f;
+
+    // Density, coverage and softness passed to SetVolumetricCloudSettings
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Clouds")
+    FVector CloudSettings = FVector(0.5f, 0.2f, 0.5f);
+
+    // Color grading, (1,1,1,1) is neutral
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Post Process")
+    FVector4 ColorSaturation = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Post Process")
+    FVector4 ColorContrast = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Post Process")
+    FVector4 ColorGain = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    // Distance blur, 0 = off
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Post Process", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float DepthOfFieldAmount = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Post Process")
+    float DepthOfFieldFocalDistance = 100000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Post Process")
+    float DepthOfFieldFstop = 32.0f;
+
+    // Particle effect intensities (0-1)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Particles", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float RainIntensity = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Particles", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float LightningIntensity = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Particles", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float FogIntensity = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Particles", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float SnowIntensity = 0.0f;
+
+    // Interpolate every setting between two presets
+    static FWeatherPreset Blend(const FWeatherPreset& A, const FWeatherPreset& B, float Alpha);
+};
+
+// One upcoming weather change
+USTRUCT(BlueprintType)
+struct FWeatherForecastEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    EWeatherType Weather = EWeatherType::Clear;
+
+    // Time until the change, in seconds
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float SecondsFromNow = 0.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWeatherApproaching, EWeatherType, UpcomingWeather, float, SecondsFromNow);
+
 UCLASS()
 class OPENWORLDEXPLORER_API AWorldManager : public AActor
 {
@@ -28,6 +98,7 @@ public:
 protected:
     // Called when the game starts or when spawned
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // The directional light representing the sun
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
@@ -49,6 +120,10 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
     class UPostProcessComponent* WeatherPostProcess;
 
+    // Pooled rain, lightning, fog and snow emitters that follow the player
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Environment")
+    class UWeatherParticleManager* WeatherParticles;
+
     // Current weather type
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment")
     EWeatherType CurrentWeather;
@@ -69,6 +144,46 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment")
     float WeatherChangeProbability;
 
+    // Which weather can follow which, falls back to the built-in transitions when empty
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Weather")
+    class UWeatherTransitionTable* WeatherTransitions;
+
+    // Seed for the weather schedule, 0 picks a new one each session
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Weather")
+    int32 WeatherSeed;
+
+    // Seconds between weather schedule steps, each step may change the weather once
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Weather", meta = (ClampMin = "0.1"))
+    float WeatherStepSeconds;
+
+    // How long before a scheduled change OnWeatherApproaching fires
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Weather", meta = (ClampMin = "0.0"))
+    float WeatherPrestreamLeadTime;
+
+    // Settings for each weather type
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Weather")
+    TMap<EWeatherType, FWeatherPreset> WeatherPresets;
+
+    // Seconds to blend from one weather to the next
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Weather", meta = (ClampMin = "0.0"))
+    float WeatherTransitionDuration;
+
+    // Optional designer-authored sun curves, baked into a per-minute table at BeginPlay
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Sky")
+    class UDayCycleProfile* DayCycleProfile;
+
+    // Sun rotation change (degrees) since the last sky capture that triggers a recapture
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Sky", meta = (ClampMin = "0.0"))
+    float SkyRecaptureAngleThreshold;
+
+    // Sun color change since the last sky capture that triggers a recapture
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Sky", meta = (ClampMin = "0.0"))
+    float SkyRecaptureColorThreshold;
+
+    // Sun intensity change since the last sky capture that triggers a recapture
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Environment|Sky", meta = (ClampMin = "0.0"))
+    float SkyRecaptureIntensityThreshold;
+
 public:    
     // Called every frame
     virtual void Tick(float DeltaTime) override;
@@ -81,21 +196,117 @@ public:
     UFUNCTION(BlueprintPure, Category = "Environment")
     float GetTimeOfDay() const { return TimeOfDay; }
 
-    // Set the current weather
+    // Set the current weather, blending over WeatherTransitionDuration unless bImmediate
     UFUNCTION(BlueprintCallable, Category = "Environment")
-    void SetWeather(EWeatherType NewWeather);
+    void SetWeather(EWeatherType NewWeather, bool bImmediate = false);
 
     // Get the current weather
     UFUNCTION(BlueprintPure, Category = "Environment")
     EWeatherType GetCurrentWeather() const { return CurrentWeather; }
 
+    // The next Count scheduled weather changes, assuming nothing else sets the weather first
+    UFUNCTION(BlueprintCallable, Category = "Environment")
+    TArray<FWeatherForecastEntry> GetWeatherForecast(int32 Count) const;
+
+    // Restart the weather schedule from a seed, 0 picks a new one
+    UFUNCTION(BlueprintCallable, Category = "Environment")
+    void SetWeatherSeed(int32 Seed);
+
+    // Seed the weather schedule is running from
+    UFUNCTION(BlueprintPure, Category = "Environment")
+    int32 GetWeatherSeed() const { return WeatherRandom.GetInitialSeed(); }
+
+    // Fires once per scheduled change, WeatherPrestreamLeadTime ahead, so its assets can be streamed in
+    UPROPERTY(BlueprintAssignable, Category = "Environment")
+    FOnWeatherApproaching OnWeatherApproaching;
+
+    // Rebuild the baked sun table, e.g. after changing DayCycleProfile at runtime
+    UFUNCTION(BlueprintCallable, Category = "Environment")
+    void BuildSunLightingTable();
+
 private:
+    // Baked sun state for one point in the day
+    struct FSunLightingSample
+    {
+        float Pitch;
+        float Intensity;
+        FLinearColor Color;
+    };
+
     // Update the sun position based on time of day
     void UpdateSunPosition();
 
-    // Update the weather effects
+    // Evaluate the sun state for a time of day from the profile or the built-in cycle
+    FSunLightingSample EvaluateSunLighting(float Time) const;
+
+    // Sun state per game minute
+    TArray<FSunLightingSample> SunLightingTable;
+
+    // Apply the current weather's preset straight away
     void UpdateWeatherEffects();
 
-    // Try to change weather randomly
-    void TryRandomWeatherChange(float DeltaTime);
+    // Advance an in-progress weather transition
+    void UpdateWeatherTransition(float DeltaTime);
+
+    // Write a (possibly blended) preset to the clouds, post process and particles
+    void ApplyWeatherPreset(const FWeatherPreset& Preset, bool bForce);
+
+    // Preset for a weather type, or defaults if none is set
+    const FWeatherPreset& GetWeatherPreset(EWeatherType Weather) const;
+
+    // Settings the transition started from and is heading to
+    FWeatherPreset TransitionFromWeather;
+    FWeatherPreset TransitionToWeather;
+
+    // Settings last written to the components
+    FWeatherPreset AppliedWeather;
+
+    // Transition progress (0-1)
+    float WeatherTransitionAlpha;
+    bool bWeatherTransitioning;
+
+    // Run the weather schedule for any whole steps that have elapsed
+    void AdvanceWeatherSchedule(float DeltaTime);
+
+    // Roll one schedule step, returns true and updates Weather if it changes
+    bool StepWeatherSchedule(FRandomStream& Random, EWeatherType& Weather) const;
+
+    // Look ahead for the next scheduled change
+    void RefreshUpcomingWeather();
+
+    // Random stream driving the weather schedule
+    FRandomStream WeatherRandom;
+
+    // Time not yet consumed by a whole schedule step
+    float WeatherStepAccumulator;
+
+    // Next scheduled change, INDEX_NONE steps if none is within the forecast horizon
+    EWeatherType UpcomingWeather;
+    int32 StepsUntilWeatherChange;
+    bool bUpcomingWeatherAnnounced;
+
+    // Mark the sky light for recapture if the sun has changed enough since the last capture.
+    // bSceneChanged skips the sun check for changes the sun doesn't show, like clouds, still within the budget
+    void RequestSkyRecapture(bool bForce, bool bSceneChanged = false);
+
+    // Run a pending sky recapture if the capture budget allows it
+    void UpdateSkyRecapture(float DeltaTime);
+
+    // Sun state at the last sky capture
+    FRotator LastCapturedSunRotation;
+    FLinearColor LastCapturedSunColor;
+    float LastCapturedSunIntensity;
+
+    // A recapture is waiting for budget
+    bool bSkyRecapturePending;
+
+    // The pending recapture should ignore the budget
+    bool bSkyRecaptureForced;
+
+    // Seconds since the sky light was last captured
+    float TimeSinceSkyRecapture;
+
+    // Recaptures counted in the current one minute window
+    int32 SkyRecapturesThisWindow;
+    float SkyRecaptureWindowTime;
 };
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldServicesSubsystem.generated.h"
+
+/**
+ * One place to find the game's singletons from anywhere in the world.
+ * World actors register themselves when they start, game instance
+ * subsystems are looked up the first time they're asked for.
+ */
+UCLASS()
+class OPENWORLDEXPLORER_API UWorldServicesSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Services for the world WorldContextObject is in, or nullptr
+    static UWorldServicesSubsystem* Get(const UObject* WorldContextObject);
+
+    // Called by the world manager on BeginPlay and EndPlay
+    void RegisterWorldManager(class AWorldManager* InWorldManager);
+    void UnregisterWorldManager(class AWorldManager* InWorldManager);
+
+    UFUNCTION(BlueprintPure, Category = "World")
+    class AWorldManager* GetWorldManager() const { return WorldManager.Get(); }
+
+    UFUNCTION(BlueprintPure, Category = "World")
+    class UProgressionSystem* GetProgressionSystem();
+
+    UFUNCTION(BlueprintPure, Category = "World")
+    class UPhotoGallerySubsystem* GetPhotoGallery();
+
+private:
+    TWeakObjectPtr<class AWorldManager> WorldManager;
+    TWeakObjectPtr<class UProgressionSystem> ProgressionSystem;
+    TWeakObjectPtr<class UPhotoGallerySubsystem> PhotoGallery;
+};
\ No newline at end of file